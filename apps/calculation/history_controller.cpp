@@ -32,6 +32,8 @@ void HistoryController::reload() {
   for (int i = 0; i < k_maxNumberOfDisplayedRows; i++) {
     m_calculationHistory[i].resetMemoization();
   }
+  // Calculations might have been pushed or deleted
+  resetMemoization();
 
   m_selectableTableView.reloadData();
   /* TODO
@@ -205,8 +207,29 @@ KDCoordinate HistoryController::rowHeight(int j) {
     return 0;
   }
   Shared::ExpiringPointer<Calculation> calculation = calculationAtIndex(j);
-  bool expanded = j == selectedRow() && selectedSubviewType() == SubviewType::Output;
-  return calculation->height(expanded);
+  return calculation->height(j == expandedRow());
+}
+
+KDCoordinate HistoryController::cumulatedHeightFromIndex(int j) {
+  /* The memoized offsets are computed with all calculations collapsed, so
+   * that they do not depend on the selection. */
+  KDCoordinate result = MemoizedListViewDataSource::cumulatedHeightFromIndex(j);
+  int expanded = expandedRow();
+  if (expanded >= 0 && expanded < j) {
+    result += rowHeight(expanded) - memoizedRowHeight(expanded);
+  }
+  return result;
+}
+
+KDCoordinate HistoryController::memoizedRowHeight(int j) {
+  if (j >= m_calculationStore->numberOfCalculations()) {
+    return 0;
+  }
+  return calculationAtIndex(j)->height(false);
+}
+
+int HistoryController::expandedRow() {
+  return selectedSubviewType() == SubviewType::Output ? selectedRow() : -1;
 }
 
 int HistoryController::typeAtLocation(int i, int j) {
@@ -3,6 +3,8 @@
 #include <apps/i18n.h>
 #include "helpers.h"
 #include <ion/unicode/utf8_helper.h>
+#include <assert.h>
+#include <stdlib.h>
 
 namespace Code {
 
@@ -26,6 +28,7 @@ App::Snapshot::Snapshot() :
 #if EPSILON_GETOPT
   m_lockOnConsole(false),
   m_hasBeenWiped(false),
+  m_pythonHeapSize(0),
 #endif
   m_scriptStore()
 {
@@ -77,12 +80,24 @@ void App::Snapshot::setOpt(const char * name, const char * value) {
     m_lockOnConsole = true;
     return;
   }
+  if (strcmp(name, "heap-size") == 0) {
+    int heapSize = atoi(value);
+    if (heapSize <= 0) {
+      m_pythonHeapSize = 0;
+    } else {
+      m_pythonHeapSize = static_cast<size_t>(heapSize) < k_minimalPythonHeapSize ? k_minimalPythonHeapSize : heapSize;
+    }
+    return;
+  }
 }
 #endif
 
 App::App(Snapshot * snapshot) :
   Shared::InputEventHandlerDelegateApp(snapshot, &m_codeStackViewController),
   m_pythonHeap{},
+#if EPSILON_GETOPT
+  m_allocatedPythonHeap(nullptr),
+#endif
   m_pythonUser(nullptr),
   m_consoleController(nullptr, this, snapshot->scriptStore()
 #if EPSILON_GETOPT
@@ -137,7 +152,22 @@ bool App::textInputDidReceiveEvent(InputEventHandler * textInput, Ion::Events::E
 
 void App::initPythonWithUser(const void * pythonUser) {
   if (!m_pythonUser) {
-    MicroPython::init(m_pythonHeap, m_pythonHeap + k_pythonHeapSize);
+    char * heap = m_pythonHeap;
+    size_t heapSize = k_pythonHeapSize;
+#if EPSILON_GETOPT
+    size_t requestedHeapSize = static_cast<Snapshot *>(snapshot())->pythonHeapSize();
+    if (requestedHeapSize > static_cast<size_t>(k_pythonHeapSize)) {
+      assert(m_allocatedPythonHeap == nullptr);
+      m_allocatedPythonHeap = static_cast<char *>(malloc(requestedHeapSize));
+      if (m_allocatedPythonHeap != nullptr) {
+        heap = m_allocatedPythonHeap;
+        heapSize = requestedHeapSize;
+      }
+    } else if (requestedHeapSize > 0) {
+      heapSize = requestedHeapSize;
+    }
+#endif
+    MicroPython::init(heap, heap + heapSize);
   }
   m_pythonUser = pythonUser;
 }
@@ -146,6 +176,10 @@ void App::deinitPython() {
   if (m_pythonUser) {
     MicroPython::deinit();
     m_pythonUser = nullptr;
+#if EPSILON_GETOPT
+    free(m_allocatedPythonHeap);
+    m_allocatedPythonHeap = nullptr;
+#endif
   }
 }
 
@@ -29,12 +29,15 @@ public:
     ScriptStore * scriptStore();
 #if EPSILON_GETOPT
     bool lockOnConsole() const;
+    size_t pythonHeapSize() const { return m_pythonHeapSize; }
     void setOpt(const char * name, const char * value) override;
 #endif
   private:
 #if EPSILON_GETOPT
     bool m_lockOnConsole;
     bool m_hasBeenWiped;
+    // 0 stands for the size chosen at build time
+    size_t m_pythonHeapSize;
 #endif
     ScriptStore m_scriptStore;
   };
@@ -74,7 +77,10 @@ public:
 
   VariableBoxController * variableBoxController() { return &m_variableBoxController; }
 
-  static constexpr int k_pythonHeapSize = 32768;
+  static constexpr int k_pythonHeapSize = EPSILON_PYTHON_HEAP_SIZE;
+#if EPSILON_GETOPT
+  static constexpr size_t k_minimalPythonHeapSize = 4096;
+#endif
 
 private:
   /* Python delegate:
@@ -83,6 +89,11 @@ private:
    * also memoize the last Python user to avoid re-initiating MicroPython when
    * unneeded. */
   char m_pythonHeap[k_pythonHeapSize];
+#if EPSILON_GETOPT
+  /* The simulator can be given a larger heap at runtime with
+   * --code-heap-size, which is then allocated when Python is initialized. */
+  char * m_allocatedPythonHeap;
+#endif
   const void * m_pythonUser;
 
   App(Snapshot * snapshot);
@@ -34,7 +34,9 @@ ConsoleController::ConsoleController(Responder * parentResponder, App * pythonDe
   m_editCell(this, this, this),
   m_scriptStore(scriptStore),
   m_sandboxController(this),
-  m_inputRunLoopActive(false)
+  m_inputRunLoopActive(false),
+  m_printRefreshPending(false),
+  m_lastPrintRefreshTime(0)
 #if EPSILON_GETOPT
   , m_locked(lockOnConsole)
 #endif
@@ -78,7 +80,7 @@ void ConsoleController::runAndPrintForCommand(const char * command) {
   // Draw the console before running the code
   m_editCell.setText("");
   m_editCell.setPrompt("");
-  refreshPrintOutput();
+  redrawConsole();
 
   runCode(storedCommand);
 
@@ -168,7 +170,7 @@ const char * ConsoleController::inputText(const char * prompt) {
   // Clear the edit cell and return the input
   text = m_editCell.shiftCurrentTextAndClear();
   m_editCell.setPrompt(previousPrompt);
-  refreshPrintOutput();
+  redrawConsole();
 
   return text;
 }
@@ -411,10 +413,18 @@ bool ConsoleController::isDisplayingViewController() {
 }
 
 void ConsoleController::refreshPrintOutput() {
+  if (m_printRefreshPending) {
+    redrawConsole();
+  }
+}
+
+void ConsoleController::redrawConsole() {
   if (!isDisplayingViewController()) {
     reloadData(false);
     AppsContainer::sharedAppsContainer()->redrawWindow();
   }
+  m_printRefreshPending = false;
+  m_lastPrintRefreshTime = Ion::Timing::millis();
 }
 
 void ConsoleController::reloadData(bool isEditing) {
@@ -449,7 +459,12 @@ void ConsoleController::printText(const char * text, size_t length) {
     assert(textCutIndex == length - 1);
     appendTextToOutputAccumulationBuffer(text, length-1);
     flushOutputAccumulationBufferToStore();
-    micropython_port_vm_hook_refresh_print();
+    /* The lines printed in between are displayed by the next refresh: the VM
+     * hook, a sleep, an input or the end of the script. */
+    m_printRefreshPending = true;
+    if (Ion::Timing::millis() - m_lastPrintRefreshTime >= k_printRefreshPeriod) {
+      refreshPrintOutput();
+    }
   }
 // #if __EMSCRIPTEN__
   /* If we called micropython_port_interrupt_if_needed here, we would need to
@@ -477,7 +492,7 @@ void ConsoleController::printText(const char * text, size_t length) {
 // #endif
 }
 
-void ConsoleController::autoImportScript(Script script, bool force) {
+void ConsoleController::autoImportScript(Script script, bool force, bool profile) {
   /* The sandbox might be displayed, for instance if we are auto-importing
    * several scripts that draw at importation. In this case, we want to remove
    * the sandbox. */
@@ -506,13 +521,32 @@ void ConsoleController::autoImportScript(Script script, bool force) {
     strlcpy(command+currentChar, k_importCommand2, k_maxImportCommandSize - currentChar);
 
     // Step 2 - Run the command
+    if (profile) {
+      MicroPython::Profiler::start();
+    }
     runAndPrintForCommand(command);
+    if (profile) {
+      MicroPython::Profiler::stop();
+      printProfilerReport();
+    }
   }
   if (!isDisplayingViewController() && force) {
     reloadData(true);
   }
 }
 
+void ConsoleController::printProfilerReport() {
+  char line[k_outputAccumulationBufferSize];
+  MicroPython::Profiler::serializeSummary(line, k_outputAccumulationBufferSize);
+  m_consoleStore.pushResult(line);
+  int numberOfHotSpots = std::min(MicroPython::Profiler::numberOfHotSpots(), MicroPython::Profiler::k_maxNumberOfReportedHotSpots);
+  for (int i = 0; i < numberOfHotSpots; i++) {
+    MicroPython::Profiler::serializeHotSpot(i, line, k_outputAccumulationBufferSize);
+    m_consoleStore.pushResult(line);
+  }
+  MicroPython::Profiler::dump();
+}
+
 void ConsoleController::flushOutputAccumulationBufferToStore() {
   m_consoleStore.pushResult(m_outputAccumulationBuffer);
   emptyOutputAccumulationBuffer();
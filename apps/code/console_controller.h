@@ -3,6 +3,7 @@
 
 #include <escher.h>
 #include <python/port/port.h>
+#include <python/port/profiler.h>
 #include <poincare/preferences.h>
 
 #include "console_edit_cell.h"
@@ -30,7 +31,7 @@ public:
 
   void setAutoImport(bool autoImport) { m_autoImportScripts = autoImport; }
   void autoImport();
-  void autoImportScript(Script script, bool force = false);
+  void autoImportScript(Script script, bool force = false, bool profile = false);
   void runAndPrintForCommand(const char * command);
   bool inputRunLoopActive() const { return m_inputRunLoopActive; }
   void terminateInputLoop();
@@ -88,9 +89,14 @@ private:
   static constexpr int k_numberOfLineCells = (Ion::Display::Height - Metric::TitleBarHeight) / 14 + 2; // 14 = KDFont::SmallFont->glyphSize().height()
   // k_numberOfLineCells = (240 - 18)/14 ~ 15.9. The 0.1 cell can be above and below the 15 other cells so we add +2 cells.
   static constexpr int k_outputAccumulationBufferSize = 100;
+  /* Redrawing the console takes much longer than printing a line, so printed
+   * lines are displayed at most every k_printRefreshPeriod milliseconds. */
+  static constexpr uint64_t k_printRefreshPeriod = 40;
   bool isDisplayingViewController();
   void reloadData(bool isEditing);
+  void redrawConsole();
   void flushOutputAccumulationBufferToStore();
+  void printProfilerReport();
   void appendTextToOutputAccumulationBuffer(const char * text, size_t length);
   void emptyOutputAccumulationBuffer();
   size_t firstNewLineCharIndex(const char * text, size_t length);
@@ -111,6 +117,8 @@ private:
   SandboxController m_sandboxController;
   bool m_inputRunLoopActive;
   bool m_autoImportScripts;
+  bool m_printRefreshPending;
+  uint64_t m_lastPrintRefreshTime;
 #if EPSILON_GETOPT
   bool m_locked;
 #endif
@@ -158,11 +158,11 @@ void MenuController::reloadConsole() {
   m_reloadConsoleWhenBecomingFirstResponder = false;
 }
 
-void MenuController::openConsoleWithScript(Script script) {
+void MenuController::openConsoleWithScript(Script script, bool profile) {
   reloadConsole();
   consoleController()->setAutoImport(false);
   stackViewController()->push(consoleController());
-  consoleController()->autoImportScript(script, true);
+  consoleController()->autoImportScript(script, true, profile);
   m_reloadConsoleWhenBecomingFirstResponder = true;
 }
 
@@ -22,7 +22,7 @@ public:
   void duplicateScript(Script script);
   void deleteScript(Script script);
   void reloadConsole();
-  void openConsoleWithScript(Script script);
+  void openConsoleWithScript(Script script, bool profile = false);
   void scriptContentEditionDidFinish();
   void willExitApp();
   int editedScriptIndex() const { return m_editorController.scriptIndex(); }
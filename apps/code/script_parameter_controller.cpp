@@ -8,6 +8,7 @@ ScriptParameterController::ScriptParameterController(Responder * parentResponder
   ViewController(parentResponder),
   m_pageTitle(title),
   m_executeScript(I18n::Message::ExecuteScript),
+  m_profileScript(I18n::Message::ProfileScript),
   m_renameScript(I18n::Message::Rename),
   m_autoImportScript(I18n::Message::AutoImportScript),
   m_deleteScript(I18n::Message::DeleteScript),
@@ -42,26 +43,30 @@ bool ScriptParameterController::handleEvent(Ion::Events::Event event) {
         return true;
       case 1:
         dismissScriptParameterController();
-        m_menuController->renameSelectedScript();
+        m_menuController->openConsoleWithScript(s, true);
         return true;
       case 2:
+        dismissScriptParameterController();
+        m_menuController->renameSelectedScript();
+        return true;
+      case 3:
         m_script.toggleAutoimportationStatus();
         m_selectableTableView.reloadData();
         m_menuController->reloadConsole();
         Container::activeApp()->setFirstResponder(&m_selectableTableView);
         return true;
-      case 3:{
+      case 4:{
         MessageTableCellWithBuffer * myCell = (MessageTableCellWithBuffer *)m_selectableTableView.selectedCell();
         m_sizedisplaypercent = !m_sizedisplaypercent;
         GetScriptSize(myCell);
         return true;
       }
-      case 4:
+      case 5:
         dismissScriptParameterController();
         m_menuController->duplicateScript(s);
         m_menuController->reloadConsole();
         return true;
-      case 5:
+      case 6:
         dismissScriptParameterController();
         m_menuController->deleteScript(s);
         m_menuController->reloadConsole();
@@ -88,7 +93,7 @@ void ScriptParameterController::didBecomeFirstResponder() {
 HighlightCell * ScriptParameterController::reusableCell(int index) {
   assert(index >= 0);
   assert(index < k_totalNumberOfCell);
-  HighlightCell * cells[] = {&m_executeScript, &m_renameScript, &m_autoImportScript, &m_size, &m_duplicateScript, &m_deleteScript};
+  HighlightCell * cells[] = {&m_executeScript, &m_profileScript, &m_renameScript, &m_autoImportScript, &m_size, &m_duplicateScript, &m_deleteScript};
   return cells[index];
 }
 
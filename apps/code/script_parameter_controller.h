@@ -31,10 +31,11 @@ public:
   void willDisplayCellForIndex(HighlightCell * cell, int index) override;
 
 private:
-  constexpr static int k_totalNumberOfCell = 6;
+  constexpr static int k_totalNumberOfCell = 7;
   StackViewController * stackViewController();
   I18n::Message m_pageTitle;
   MessageTableCell m_executeScript;
+  MessageTableCell m_profileScript;
   MessageTableCell m_renameScript;
   MessageTableCellWithSwitch m_autoImportScript;
   MessageTableCell m_deleteScript;
@@ -35,48 +35,160 @@ bool isSane(const TarHeader* tar) {
   return !memcmp(tar->magic, "ustar  ", 8) && tar->name[0] != '\x00' && tar->name[0] != '\xFF';
 }
 
-bool isExamModeAndFileNotExecutable(const TarHeader* tar) {
-  return GlobalPreferences::sharedGlobalPreferences()->isInExamMode() && (tar->mode[4] & 0x01) == 0;
+bool isExecutable(const TarHeader* tar) {
+  return (tar->mode[4] & 0x01) == 1;
+}
+
+/* The archive is a read-only TAR file in the external flash, in which headers
+ * can only be found by walking the archive from its start. The directory of
+ * the archive is therefore indexed once, at first access: finding a file by
+ * index or by name then no longer requires to parse all the previous headers.
+ * Archives with more files than the directory can hold are still supported,
+ * the files that do not fit in it being looked up from the last indexed one.
+ * The archive can be rewritten over USB while the device is running: the
+ * checksums of the first header and of the header ending the directory are
+ * kept to index it again once it has changed. */
+
+static const TarHeader* const k_archiveStart = reinterpret_cast<const TarHeader*>(0x90200000);
+constexpr int k_directorySize = 64;
+
+struct DirectoryEntry {
+  uint32_t headerOffset;
+  uint32_t dataLength;
+  uint16_t nameHash;
+};
+
+static DirectoryEntry sDirectory[k_directorySize];
+static int sNumberOfIndexedFiles = -1;
+// Only the leading executables are visible in exam mode
+static int sNumberOfLeadingExecutables = 0;
+static bool sDirectoryIsComplete = false;
+static uint32_t sDirectoryEndOffset = 0;
+/* Files beyond the directory are usually requested in increasing order: the
+ * walk goes on from the last header it reached, so listing them all stays
+ * linear in the number of headers. */
+static size_t sWalkIndex = 0;
+static uint32_t sWalkOffset = 0;
+// Whether the files walked beyond the directory are all executables
+static bool sWalkFoundOnlyExecutables = true;
+static char sArchiveStartChecksum[sizeof(TarHeader::chksum)];
+static char sDirectoryEndChecksum[sizeof(TarHeader::chksum)];
+
+static uint16_t nameHash(const char * name) {
+  // FNV-1a, folded to 16 bits
+  uint32_t hash = 2166136261u;
+  while (*name != 0) {
+    hash = (hash ^ static_cast<uint8_t>(*name++)) * 16777619u;
+  }
+  return static_cast<uint16_t>(hash ^ (hash >> 16));
+}
+
+static uint32_t dataLength(const TarHeader* tar) {
+  uint32_t size = 0;
+  for (int i = 0; i < 11; i++) {
+    size = size * 8 + (tar->size[i] - '0');
+  }
+  return size;
+}
+
+const TarHeader* nextHeader(const TarHeader* tar) {
+  // TAR files are comprised of a set of records aligned to 512 bytes boundary followed by data.
+  unsigned stride = (sizeof(TarHeader) + dataLength(tar) + 511);
+  stride = (stride >> 9) << 9;
+  return reinterpret_cast<const TarHeader*>(reinterpret_cast<const char*>(tar) + stride);
+}
+
+static const TarHeader* headerAtOffset(uint32_t offset) {
+  return reinterpret_cast<const TarHeader*>(reinterpret_cast<const char*>(k_archiveStart) + offset);
+}
+
+static uint32_t offsetOfHeader(const TarHeader* tar) {
+  return reinterpret_cast<const char*>(tar) - reinterpret_cast<const char*>(k_archiveStart);
+}
+
+static bool directoryIsUpToDate() {
+  return sNumberOfIndexedFiles >= 0
+    && memcmp(sArchiveStartChecksum, k_archiveStart->chksum, sizeof(sArchiveStartChecksum)) == 0
+    && memcmp(sDirectoryEndChecksum, headerAtOffset(sDirectoryEndOffset)->chksum, sizeof(sDirectoryEndChecksum)) == 0;
+}
+
+static void buildDirectory() {
+  if (directoryIsUpToDate()) {
+    return;
+  }
+  sNumberOfIndexedFiles = 0;
+  sNumberOfLeadingExecutables = 0;
+  sDirectoryIsComplete = true;
+  sWalkIndex = 0;
+  bool onlyExecutables = true;
+  const TarHeader* tar = k_archiveStart;
+  while (isSane(tar)) {
+    if (sNumberOfIndexedFiles == k_directorySize) {
+      sDirectoryIsComplete = false;
+      break;
+    }
+    DirectoryEntry & entry = sDirectory[sNumberOfIndexedFiles++];
+    entry.headerOffset = offsetOfHeader(tar);
+    entry.dataLength = dataLength(tar);
+    entry.nameHash = nameHash(tar->name);
+    onlyExecutables = onlyExecutables && isExecutable(tar);
+    sNumberOfLeadingExecutables += onlyExecutables;
+    tar = nextHeader(tar);
+  }
+  sDirectoryEndOffset = offsetOfHeader(tar);
+  memcpy(sArchiveStartChecksum, k_archiveStart->chksum, sizeof(sArchiveStartChecksum));
+  memcpy(sDirectoryEndChecksum, tar->chksum, sizeof(sDirectoryEndChecksum));
+}
+
+bool isInExamMode() {
+  return GlobalPreferences::sharedGlobalPreferences()->isInExamMode();
+}
+
+static void fillEntry(const TarHeader* tar, uint32_t length, File &entry) {
+  entry.name = tar->name;
+  entry.data = reinterpret_cast<const uint8_t*>(tar) + sizeof(TarHeader);
+  entry.dataLength = length;
+  entry.isExecutable = isExecutable(tar);
 }
 
 bool fileAtIndex(size_t index, File &entry) {
   if (index == -1)
     return false;
-  
-  const TarHeader* tar = reinterpret_cast<const TarHeader*>(0x90200000);
-  unsigned size = 0;
 
-  // Sanity check.
-  if (!isSane(tar) || isExamModeAndFileNotExecutable(tar)) {
+  buildDirectory();
+  if (index < static_cast<size_t>(sNumberOfIndexedFiles)) {
+    if (isInExamMode() && index >= static_cast<size_t>(sNumberOfLeadingExecutables)) {
+      return false;
+    }
+    const TarHeader* tar = headerAtOffset(sDirectory[index].headerOffset);
+    fillEntry(tar, sDirectory[index].dataLength, entry);
+    return true;
+  }
+  if (sDirectoryIsComplete || (isInExamMode() && sNumberOfLeadingExecutables < sNumberOfIndexedFiles)) {
     return false;
   }
 
-  /**
-   * TAR files are comprised of a set of records aligned to 512 bytes boundary
-   * followed by data.
-   */
-  while (index-- > 0) {
-    size = 0;
-    for (int i = 0; i < 11; i++)
-      size = size * 8 + (tar->size[i] - '0');
-
-    // Move to the next TAR header.
-    unsigned stride = (sizeof(TarHeader) + size + 511);
-    stride = (stride >> 9) << 9;
-    tar = reinterpret_cast<const TarHeader*>(reinterpret_cast<const char*>(tar) + stride);
-
-    // Sanity check.
-    if (!isSane(tar) || isExamModeAndFileNotExecutable(tar)) {
+  // The file is beyond the directory, walk the archive from its last entry
+  if (sWalkIndex < static_cast<size_t>(k_directorySize - 1) || sWalkIndex > index) {
+    sWalkIndex = k_directorySize - 1;
+    sWalkOffset = sDirectory[k_directorySize - 1].headerOffset;
+    sWalkFoundOnlyExecutables = true;
+  }
+  const TarHeader* tar = headerAtOffset(sWalkOffset);
+  while (sWalkIndex < index) {
+    const TarHeader* next = nextHeader(tar);
+    if (!isSane(next)) {
       return false;
     }
+    tar = next;
+    sWalkIndex++;
+    sWalkOffset = offsetOfHeader(tar);
+    sWalkFoundOnlyExecutables = sWalkFoundOnlyExecutables && isExecutable(tar);
   }
-
-  // File entry found, copy data out.
-  entry.name = tar->name;
-  entry.data = reinterpret_cast<const uint8_t*>(tar) + sizeof(TarHeader);
-  entry.dataLength = size;
-  entry.isExecutable = (tar->mode[4] & 0x01) == 1;
-
+  if (isInExamMode() && !sWalkFoundOnlyExecutables) {
+    return false;
+  }
+  fillEntry(tar, dataLength(tar), entry);
   return true;
 }
 
@@ -98,10 +210,12 @@ uint32_t executeFile(const char *name, void * heap, const uint32_t heapSize) {
 }
 
 int indexFromName(const char *name) {
+  buildDirectory();
+  uint16_t hash = nameHash(name);
   File entry;
-
   for (int i = 0; fileAtIndex(i, entry); i++) {
-    if (strcmp(name, entry.name) == 0) {
+    // Names of indexed files are only compared when their hashes match
+    if ((i >= sNumberOfIndexedFiles || sDirectory[i].nameHash == hash) && strcmp(name, entry.name) == 0) {
       return i;
     }
   }
@@ -110,10 +224,17 @@ int indexFromName(const char *name) {
 }
 
 size_t numberOfFiles() {
+  buildDirectory();
+  if (isInExamMode() && sNumberOfLeadingExecutables < sNumberOfIndexedFiles) {
+    return sNumberOfLeadingExecutables;
+  }
+  if (sDirectoryIsComplete) {
+    return sNumberOfIndexedFiles;
+  }
   File dummy;
   size_t count;
 
-  for (count = 0; fileAtIndex(count, dummy); count++);
+  for (count = sNumberOfIndexedFiles; fileAtIndex(count, dummy); count++);
 
   return count;
 }
@@ -194,5 +315,22 @@ size_t numberOfFiles() {
 
 #endif
 
+static bool nameHasExtension(const char * name, const char * extension) {
+  size_t nameLength = strlen(name);
+  size_t extensionLength = strlen(extension);
+  return nameLength >= extensionLength && strcmp(name + nameLength - extensionLength, extension) == 0;
+}
+
+int filesWithExtension(const char * extension, File * files, int filesSize) {
+  size_t n = numberOfFiles();
+  int count = 0;
+  for (size_t i = 0; i < n && count < filesSize; i++) {
+    if (fileAtIndex(i, files[count]) && nameHasExtension(files[count].name, extension)) {
+      count++;
+    }
+  }
+  return count;
+}
+
 }
 }
@@ -22,6 +22,8 @@ size_t numberOfFiles();
 size_t numberOfExecutables();
 bool executableAtIndex(size_t index, File &entry);
 uint32_t executeFile(const char *name, void * heap, const uint32_t heapSize);
+// Fills files with at most filesSize files whose name ends with extension
+int filesWithExtension(const char * extension, File * files, int filesSize);
 
 }
 }
@@ -1,6 +1,8 @@
 #include "calculation_graph_controller.h"
 #include "../app.h"
 #include "../../apps_container.h"
+#include <algorithm>
+#include <cmath>
 
 using namespace Shared;
 using namespace Poincare;
@@ -51,6 +53,18 @@ Coordinate2D<double> CalculationGraphController::computeNewPointOfInterestFromAb
   double step = m_graphRange->xGridUnit()/10.0;
   step = direction < 0 ? -step : step;
   double max = direction > 0 ? m_graphRange->xMax() : m_graphRange->xMin();
+  const FunctionSampling::Curve * curve = searchesRootsOrExtrema() ? m_graphView->sampledCurve(m_record) : nullptr;
+  int startIndex = curve != nullptr ? curve->indexBeforeAbscissa(start, direction) : -1;
+  int maxIndex = curve != nullptr ? curve->indexBeforeAbscissa(max, -direction) : -1;
+  // The sampling is only finer than the scan if the step is larger
+  if (startIndex >= 0 && maxIndex >= 0 && std::fabs(step) >= curve->step()) {
+    int index = curve->nextIndexOfInterest(startIndex, direction);
+    if (index < 0 || (index - maxIndex) * direction > 0) {
+      return Coordinate2D<double>(NAN, NAN);
+    }
+    double candidateStart = curve->abscissaAtIndex(index - direction) - 2 * step;
+    start = direction > 0 ? std::max(start, candidateStart) : std::min(start, candidateStart);
+  }
   return computeNewPointOfInterest(start, step, max, textFieldDelegateApp()->localContext());
 }
 
@@ -23,6 +23,9 @@ protected:
   Poincare::Coordinate2D<double> computeNewPointOfInterestFromAbscissa(double start, int direction);
   ContinuousFunctionStore * functionStore() const;
   virtual Poincare::Coordinate2D<double> computeNewPointOfInterest(double start, double step, double max, Poincare::Context * context) = 0;
+  /* Roots and extrema can only lie around the samples where the function
+   * changes sign or direction, so the scan can start right before them. */
+  virtual bool searchesRootsOrExtrema() const { return false; }
   GraphView * m_graphView;
   BannerView * m_bannerView;
   Shared::InteractiveCurveViewRange * m_graphRange;
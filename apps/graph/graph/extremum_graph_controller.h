@@ -12,6 +12,7 @@ public:
   TELEMETRY_ID("Minimum");
 private:
   Poincare::Coordinate2D<double> computeNewPointOfInterest(double start, double step, double max, Poincare::Context * context) override;
+  bool searchesRootsOrExtrema() const override { return true; }
 };
 
 class MaximumGraphController : public CalculationGraphController {
@@ -21,6 +22,7 @@ public:
   TELEMETRY_ID("Maximum");
 private:
   Poincare::Coordinate2D<double> computeNewPointOfInterest(double start, double step, double max, Poincare::Context * context) override;
+  bool searchesRootsOrExtrema() const override { return true; }
 };
 
 }
@@ -0,0 +1,115 @@
+#include "function_sampling.h"
+#include "../app.h"
+#include <assert.h>
+#include <cmath>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+int FunctionSampling::Curve::indexOfAbscissa(float x) const {
+  constexpr float k_tolerance = 1.0f / 32.0f;
+  float position = (x - m_xStart) / m_xStep;
+  float i = std::round(position);
+  if (!(std::fabs(position - i) <= k_tolerance) || i < 0.0f || i >= m_numberOfSamples) {
+    return -1;
+  }
+  return static_cast<int>(i);
+}
+
+int FunctionSampling::Curve::indexBeforeAbscissa(float x, int direction) const {
+  assert(direction == 1 || direction == -1);
+  float position = (x - m_xStart) / m_xStep;
+  float i = direction > 0 ? std::floor(position) : std::ceil(position);
+  if (!(i >= 0.0f && i < m_numberOfSamples)) {
+    return -1;
+  }
+  return static_cast<int>(i);
+}
+
+static bool IsDefined(float y) {
+  return !std::isnan(y) && !std::isinf(y);
+}
+
+bool FunctionSampling::Curve::mayHavePointOfInterestAroundIndex(int i) const {
+  assert(0 <= i && i < m_numberOfSamples);
+  float y = m_values[i];
+  float previousY = i > 0 ? m_values[i-1] : NAN;
+  float nextY = i < m_numberOfSamples - 1 ? m_values[i+1] : NAN;
+  if (!IsDefined(y)) {
+    // A bound of the domain
+    return IsDefined(previousY) || IsDefined(nextY);
+  }
+  if (!IsDefined(nextY)) {
+    return i < m_numberOfSamples - 1;
+  }
+  // A root, possibly a double one which is also an extremum
+  if (y * nextY <= 0.0f) {
+    return true;
+  }
+  // An extremum
+  return IsDefined(previousY) && (y - previousY) * (nextY - y) <= 0.0f;
+}
+
+int FunctionSampling::Curve::nextIndexOfInterest(int start, int direction) const {
+  assert(direction == 1 || direction == -1);
+  for (int i = start; i >= 0 && i < m_numberOfSamples; i += direction) {
+    if (mayHavePointOfInterestAroundIndex(i)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+FunctionSampling::FunctionSampling() :
+  m_nextCurve(0),
+  m_storageChangeCount(Ion::Storage::sharedStorage()->changeCount()),
+  m_angleUnit(Preferences::sharedPreferences()->angleUnit())
+{
+}
+
+const FunctionSampling::Curve * FunctionSampling::sampleFunction(Ion::Storage::Record record, float xStart, float xStep, int numberOfSamples, Context * context) {
+  assert(numberOfSamples <= k_maxNumberOfSamples);
+  if (!isUpToDate()) {
+    for (int i = 0; i < k_numberOfCurves; i++) {
+      m_curves[i] = Curve();
+    }
+    m_storageChangeCount = Ion::Storage::sharedStorage()->changeCount();
+    m_angleUnit = Preferences::sharedPreferences()->angleUnit();
+  }
+  const Curve * sampledCurve = curveForRecord(record, xStart, xStep);
+  if (sampledCurve != nullptr && sampledCurve->m_numberOfSamples >= numberOfSamples) {
+    return sampledCurve;
+  }
+  Curve * curve = m_curves + m_nextCurve;
+  m_nextCurve = (m_nextCurve + 1) % k_numberOfCurves;
+  ExpiringPointer<ContinuousFunction> f = App::app()->functionStore()->modelForRecord(record);
+  assert(f->plotType() == ContinuousFunction::PlotType::Cartesian);
+  for (int i = 0; i < numberOfSamples; i++) {
+    curve->m_values[i] = f->evaluateXYAtParameter(xStart + i * xStep, context).x2();
+  }
+  curve->m_record = record;
+  curve->m_xStart = xStart;
+  curve->m_xStep = xStep;
+  curve->m_numberOfSamples = numberOfSamples;
+  return curve;
+}
+
+const FunctionSampling::Curve * FunctionSampling::curveForRecord(Ion::Storage::Record record, float xStart, float xStep) const {
+  if (!isUpToDate()) {
+    return nullptr;
+  }
+  for (int i = 0; i < k_numberOfCurves; i++) {
+    if (m_curves[i].isOnGrid(record, xStart, xStep)) {
+      return m_curves + i;
+    }
+  }
+  return nullptr;
+}
+
+bool FunctionSampling::isUpToDate() const {
+  return m_storageChangeCount == Ion::Storage::sharedStorage()->changeCount() && m_angleUnit == Preferences::sharedPreferences()->angleUnit();
+}
+
+}
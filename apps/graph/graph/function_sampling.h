@@ -0,0 +1,77 @@
+#ifndef GRAPH_FUNCTION_SAMPLING_H
+#define GRAPH_FUNCTION_SAMPLING_H
+
+#include <assert.h>
+#include <ion/display.h>
+#include <ion/storage.h>
+#include <poincare/context.h>
+#include <poincare/preferences.h>
+#include <math.h>
+#include <stdint.h>
+
+namespace Graph {
+
+/* The values of the cartesian functions on the abscissas of the graph are
+ * needed several times when the graph is displayed: to compute the automatic
+ * y range, to draw the curves and to look for points of interest. A
+ * FunctionSampling records them once, on a grid of one abscissa every half
+ * pixel starting at the leftmost abscissa drawn by CurveView, so that the
+ * drawing finds its abscissas on the grid.
+ * A curve is keyed by the record of its function and by its grid. The values
+ * also depend on the expression of the function, on the symbols it uses and
+ * on the angle unit: all curves are forgotten when one of those changes. */
+
+class FunctionSampling {
+public:
+  constexpr static int k_numberOfSamplesPerPixel = 2;
+  // The grid extends beyond the view like CurveView::k_externRectMargin
+  constexpr static int k_numberOfMarginPixels = 2;
+  constexpr static int k_maxNumberOfSamples = k_numberOfSamplesPerPixel * (Ion::Display::Width - 1 + 2 * k_numberOfMarginPixels) + 1;
+
+  class Curve {
+    friend class FunctionSampling;
+  public:
+    Curve() : m_record(), m_xStart(NAN), m_xStep(NAN), m_numberOfSamples(0) {}
+    int numberOfSamples() const { return m_numberOfSamples; }
+    float step() const { return m_xStep; }
+    float abscissaAtIndex(int i) const { return m_xStart + i * m_xStep; }
+    float valueAtIndex(int i) const { assert(0 <= i && i < m_numberOfSamples); return m_values[i]; }
+    /* Index of the sample at abscissa x, or -1 if x is not on the grid. Up to a
+     * small fraction of a pixel, a value is not different from the value on the
+     * grid. */
+    int indexOfAbscissa(float x) const;
+    /* Index of the last sample before x, or from x, in the direction, or -1
+     * if x is out of the grid. */
+    int indexBeforeAbscissa(float x, int direction) const;
+    /* Index of the first sample from index start in the direction where a
+     * root, an extremum or a bound of the domain of the function may lie
+     * within one sample, or -1 if the function is sampled without any. */
+    int nextIndexOfInterest(int start, int direction) const;
+  private:
+    bool isOnGrid(Ion::Storage::Record record, float xStart, float xStep) const { return m_record == record && m_xStart == xStart && m_xStep == xStep; }
+    bool mayHavePointOfInterestAroundIndex(int i) const;
+    Ion::Storage::Record m_record;
+    float m_xStart;
+    float m_xStep;
+    int m_numberOfSamples;
+    float m_values[k_maxNumberOfSamples];
+  };
+
+  FunctionSampling();
+  /* Sample the function of record on numberOfSamples abscissas from xStart,
+   * unless it is already. */
+  const Curve * sampleFunction(Ion::Storage::Record record, float xStart, float xStep, int numberOfSamples, Poincare::Context * context);
+  // The curve of record on the grid, or nullptr if it was not sampled
+  const Curve * curveForRecord(Ion::Storage::Record record, float xStart, float xStep) const;
+private:
+  constexpr static int k_numberOfCurves = 4;
+  bool isUpToDate() const;
+  Curve m_curves[k_numberOfCurves];
+  int m_nextCurve;
+  uint32_t m_storageChangeCount;
+  Poincare::Preferences::AngleUnit m_angleUnit;
+};
+
+}
+
+#endif
@@ -39,6 +39,39 @@ bool GraphController::defautRangeIsNormalized() const {
   return functionStore()->displaysNonCartesianFunctions();
 }
 
+InteractiveCurveViewRangeDelegate::Range GraphController::computeYRange(InteractiveCurveViewRange * interactiveCurveViewRange) {
+  /* The cartesian functions are sampled on the abscissas of the view, so that
+   * the values are computed once for the range, the drawing of the curves and
+   * the search for points of interest. */
+  if (interactiveCurveViewRange != m_graphRange || functionStore()->displaysNonCartesianFunctions()) {
+    return FunctionGraphController::computeYRange(interactiveCurveViewRange);
+  }
+  Poincare::Context * context = textFieldDelegateApp()->localContext();
+  float xMin = interactiveCurveViewRange->xMin();
+  float xMax = interactiveCurveViewRange->xMax();
+  float min = FLT_MAX;
+  float max = -FLT_MAX;
+  assert(functionStore()->numberOfActiveFunctions() > 0);
+  for (int i = 0; i < functionStore()->numberOfActiveFunctions(); i++) {
+    const FunctionSampling::Curve * curve = m_view.sampleFunction(functionStore()->activeRecordAtIndex(i), context);
+    if (curve == nullptr) {
+      return FunctionGraphController::computeYRange(interactiveCurveViewRange);
+    }
+    for (int j = 0; j < curve->numberOfSamples(); j++) {
+      float x = curve->abscissaAtIndex(j);
+      float y = curve->valueAtIndex(j);
+      if (x >= xMin && x <= xMax && !std::isnan(y) && !std::isinf(y)) {
+        min = std::min(min, y);
+        max = std::max(max, y);
+      }
+    }
+  }
+  InteractiveCurveViewRangeDelegate::Range range;
+  range.min = min;
+  range.max = max;
+  return range;
+}
+
 void GraphController::interestingFunctionRange(ExpiringPointer<ContinuousFunction> f, float tMin, float tMax, float step, float * xm, float * xM, float * ym, float * yM) const {
   Poincare::Context * context = textFieldDelegateApp()->localContext();
   const int balancedBound = std::floor((tMax-tMin)/2/step);
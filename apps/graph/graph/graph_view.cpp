@@ -9,6 +9,7 @@ namespace Graph {
 GraphView::GraphView(InteractiveCurveViewRange * graphRange,
   CurveViewCursor * cursor, Shared::BannerView * bannerView, CursorView * cursorView) :
   FunctionGraphView(graphRange, cursor, bannerView, cursorView),
+  m_functionSampling(),
   m_tangent(false)
 {
 }
@@ -21,6 +22,15 @@ void GraphView::reload() {
   return FunctionGraphView::reload();
 }
 
+const FunctionSampling::Curve * GraphView::sampleFunction(Ion::Storage::Record record, Poincare::Context * context) {
+  if (bounds().width() <= 1 || bounds().width() > Ion::Display::Width) {
+    return nullptr;
+  }
+  int numberOfPixels = bounds().width() + 2 * FunctionSampling::k_numberOfMarginPixels;
+  int numberOfSamples = FunctionSampling::k_numberOfSamplesPerPixel * (numberOfPixels - 1) + 1;
+  return m_functionSampling.sampleFunction(record, samplingStart(), samplingStep(), numberOfSamples, context);
+}
+
 void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
   FunctionGraphView::drawRect(ctx, rect);
   ContinuousFunctionStore * functionStore = App::app()->functionStore();
@@ -53,11 +63,28 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
 
     // Cartesian
     if (type == Shared::ContinuousFunction::PlotType::Cartesian) {
+      /* The abscissas drawn are on the grid of the sampled curve if the
+       * function was sampled for the current window. */
+      struct SampledFunction {
+        ContinuousFunction * function;
+        const FunctionSampling::Curve * curve;
+      };
+      SampledFunction model = {f.operator->(), sampledCurve(record)};
       drawCartesianCurve(ctx, rect, tmin, tmax, [](float t, void * model, void * context) {
-            ContinuousFunction * f = (ContinuousFunction *)model;
+            SampledFunction * sampledFunction = (SampledFunction *)model;
+            const FunctionSampling::Curve * curve = sampledFunction->curve;
+            int index = curve != nullptr ? curve->indexOfAbscissa(t) : -1;
+            if (index >= 0) {
+              return Poincare::Coordinate2D<float>(t, curve->valueAtIndex(index));
+            }
+            Poincare::Context * c = (Poincare::Context *)context;
+            return sampledFunction->function->evaluateXYAtParameter(t, c);
+          }, &model, context(), f->color(), true, record == m_selectedRecord, m_highlightedStart, m_highlightedEnd,
+          [](float tMin, float tMax, void * model, void * context) {
+            ContinuousFunction * f = ((SampledFunction *)model)->function;
             Poincare::Context * c = (Poincare::Context *)context;
-            return f->evaluateXYAtParameter(t, c);
-          }, f.operator->(), context(), f->color(), true, record == m_selectedRecord, m_highlightedStart, m_highlightedEnd);
+            return f->enclosureOnRange(tMin, tMax, c);
+          });
       /* Draw tangent */
       if (m_tangent && record == m_selectedRecord) {
         float tangentParameterA = f->approximateDerivative(m_curveViewCursor->x(), context());
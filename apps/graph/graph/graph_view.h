@@ -2,6 +2,7 @@
 #define GRAPH_GRAPH_VIEW_H
 
 #include "../../shared/function_graph_view.h"
+#include "function_sampling.h"
 
 namespace Graph {
 
@@ -17,7 +18,14 @@ public:
    * of the application graph. We thereby avoid to uselessly reload some part
    * of the graph where the area under the curve is colored. */
   void setAreaHighlightColor(bool highlightColor) override {};
+  /* Sample the cartesian function of record on the abscissas of the current
+   * window, every half pixel. */
+  const FunctionSampling::Curve * sampleFunction(Ion::Storage::Record record, Poincare::Context * context);
+  const FunctionSampling::Curve * sampledCurve(Ion::Storage::Record record) const { return m_functionSampling.curveForRecord(record, samplingStart(), samplingStep()); }
 private:
+  float samplingStart() const { return pixelToFloat(Axis::Horizontal, -FunctionSampling::k_numberOfMarginPixels); }
+  float samplingStep() const { return pixelWidth() / FunctionSampling::k_numberOfSamplesPerPixel; }
+  FunctionSampling m_functionSampling;
   bool m_tangent;
 };
 
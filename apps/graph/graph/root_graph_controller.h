@@ -12,6 +12,7 @@ public:
   TELEMETRY_ID("Root");
 private:
   Poincare::Coordinate2D<double> computeNewPointOfInterest(double start, double step, double max, Poincare::Context * context) override;
+  bool searchesRootsOrExtrema() const override { return true; }
 };
 
 }
@@ -14,8 +14,18 @@ AppCell::AppCell() :
 
 
 void AppCell::drawRect(KDContext * ctx, KDRect rect) const {
-  KDSize nameSize = m_nameView.minimalSizeForOptimalDisplay();
-  ctx->fillRect(KDRect(0,  bounds().height()-nameSize.height() - 2*k_nameHeightMargin, bounds().width(), nameSize.height()+2*k_nameHeightMargin), Palette::HomeBackground);
+  /* The cell paints its whole background: once scrolled, the pixels around
+   * the icon would otherwise still be those of the previous content. The icon
+   * is left out to avoid flickering. */
+  if (!m_visible) {
+    ctx->fillRect(bounds(), Palette::HomeBackground);
+    return;
+  }
+  KDRect icon = iconFrame();
+  ctx->fillRect(KDRect(0, 0, bounds().width(), icon.top()), Palette::HomeBackground);
+  ctx->fillRect(KDRect(0, icon.top(), icon.left(), icon.height()), Palette::HomeBackground);
+  ctx->fillRect(KDRect(icon.right() + 1, icon.top(), bounds().width() - icon.right() - 1, icon.height()), Palette::HomeBackground);
+  ctx->fillRect(KDRect(0, icon.bottom() + 1, bounds().width(), bounds().height() - icon.bottom() - 1), Palette::HomeBackground);
 }
 
 int AppCell::numberOfSubviews() const {
@@ -28,11 +38,15 @@ View * AppCell::subviewAtIndex(int index) {
 }
 
 void AppCell::layoutSubviews(bool force) {
-  m_iconView.setFrame(KDRect((bounds().width()-k_iconWidth)/2, k_iconMargin, k_iconWidth,k_iconHeight), force);
+  m_iconView.setFrame(iconFrame(), force);
   KDSize nameSize = m_nameView.minimalSizeForOptimalDisplay();
   m_nameView.setFrame(KDRect((bounds().width()-nameSize.width())/2-k_nameWidthMargin, bounds().height()-nameSize.height() - 2*k_nameHeightMargin, nameSize.width()+2*k_nameWidthMargin, nameSize.height()+2*k_nameHeightMargin), force);
 }
 
+KDRect AppCell::iconFrame() const {
+  return KDRect((bounds().width()-k_iconWidth)/2, k_iconMargin, k_iconWidth, k_iconHeight);
+}
+
 void AppCell::setExtAppDescriptor(const char* name, const Image* icon) {
   m_external_app = true;
   m_iconView.setImage(icon);
@@ -19,6 +19,7 @@ public:
   void setAppDescriptor(::App::Descriptor * appDescriptor);
   void setExtAppDescriptor(const char* name, const Image* icon);
 private:
+  KDRect iconFrame() const;
   static constexpr KDCoordinate k_iconMargin = 22;
   static constexpr KDCoordinate k_iconWidth = 55;
   static constexpr KDCoordinate k_iconHeight = 56;
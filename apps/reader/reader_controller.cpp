@@ -11,7 +11,7 @@ ReaderController::ReaderController(Responder * parentResponder) :
   ViewController(parentResponder),
   m_tableView(this, this)
 {
-  m_nbFiles = filesWithExtention(".txt", m_files, NB_FILES);
+  m_nbFiles = reader::filesWithExtention(".txt", m_files, NB_FILES);
 }
 
 int ReaderController::numberOfRows() const{
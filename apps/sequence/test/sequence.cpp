@@ -1,5 +1,6 @@
 #include <quiz.h>
 #include <apps/shared/global_context.h>
+#include <poincare/rational.h>
 #include <string.h>
 #include <assert.h>
 #include <cmath>
@@ -338,6 +339,29 @@ QUIZ_CASE(sequence_evaluation) {
   check_sequences_defined_by(results28, types, definitions, conditions1, conditions2);
 }
 
+QUIZ_CASE(sequence_reduction_cache) {
+  Shared::GlobalContext globalContext;
+  SequenceStore store;
+  SequenceContext sequenceContext(&globalContext, &store);
+  globalContext.setExpressionForSymbolAbstract(Rational::Builder(3), Symbol::Builder('a'));
+
+  Sequence * u = addSequence(&store, Sequence::Type::Explicit, "a*n+1", nullptr, nullptr, &globalContext);
+  quiz_assert(u->evaluateXYAtParameter(2.0, &sequenceContext).x2() == 7.0);
+  // The models are forgotten, the reduced definition is found in the cache
+  store.tidy();
+  u = store.modelForRecord(store.recordAtIndex(0));
+  quiz_assert(u->evaluateXYAtParameter(2.0, &sequenceContext).x2() == 7.0);
+  // Redefining a symbol invalidates the reductions that replaced it
+  globalContext.setExpressionForSymbolAbstract(Rational::Builder(4), Symbol::Builder('a'));
+  store.tidy();
+  sequenceContext.resetCache();
+  u = store.modelForRecord(store.recordAtIndex(0));
+  quiz_assert(u->evaluateXYAtParameter(2.0, &sequenceContext).x2() == 9.0);
+
+  store.removeAll();
+  Ion::Storage::sharedStorage()->destroyRecordWithBaseNameAndExtension("a", Ion::Storage::expExtension);
+}
+
 QUIZ_CASE(sequence_sum_evaluation) {
   check_sum_of_sequence_between_bounds(33.0, 3.0, 8.0, Sequence::Type::Explicit, "n", nullptr, nullptr);
   check_sum_of_sequence_between_bounds(70.0, 2.0, 8.0, Sequence::Type::SingleRecurrence, "u(n)+2", "0", nullptr);
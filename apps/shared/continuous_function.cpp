@@ -203,6 +203,13 @@ Poincare::Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t,
   return Coordinate2D<T>(x1x2.x2() * std::cos(angle), x1x2.x2() * std::sin(angle));
 }
 
+Enclosure ContinuousFunction::enclosureOnRange(float tMin, float tMax, Poincare::Context * context) const {
+  if (plotType() != PlotType::Cartesian || tMin < this->tMin() || tMax > this->tMax()) {
+    return Enclosure::Unknown();
+  }
+  return PoincareHelpers::EnclosureOnRange(expressionReduced(context), tMin, tMax, context);
+}
+
 bool ContinuousFunction::displayDerivative() const {
   return recordData()->displayDerivative();
 }
@@ -234,11 +241,10 @@ double ContinuousFunction::approximateDerivative(double x, Poincare::Context * c
   if (x < tMin() || x > tMax()) {
     return NAN;
   }
-  Poincare::Derivative derivative = Poincare::Derivative::Builder(expressionReduced(context).clone(), Symbol::Builder(UCodePointUnknown), Poincare::Float<double>::Builder(x)); // derivative takes ownership of Poincare::Float<double>::Builder(x) and the clone of expression
-  /* TODO: when we approximate derivative, we might want to simplify the
-   * derivative here. However, we might want to do it once for all x (to avoid
-   * lagging in the derivative table. */
-  return PoincareHelpers::ApproximateToScalar<double>(derivative, context);
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknownX[bufferSize];
+  SerializationHelper::CodePoint(unknownX, bufferSize, UCodePointUnknown);
+  return PoincareHelpers::ApproximateWithValueForSymbol(m_model.expressionDerivateReduced(this, context), unknownX, x, context);
 }
 
 float ContinuousFunction::tMin() const {
@@ -265,6 +271,34 @@ size_t ContinuousFunction::Model::expressionSize(const Ion::Storage::Record * re
   return record->value().size-sizeof(RecordDataBuffer);
 }
 
+Poincare::Expression ContinuousFunction::Model::expressionDerivateReduced(const Ion::Storage::Record * record, Poincare::Context * context) const {
+  if (m_expressionDerivate.isUninitialized()) {
+    /* The derivative is evaluated at the unknown itself: derivation rules then
+     * turn it into an expression of the unknown, and the remaining Derivative
+     * nodes, if any, are approximated numerically. */
+    m_expressionDerivate = Poincare::Derivative::Builder(expressionReduced(record, context).clone(), Symbol::Builder(UCodePointUnknown), Symbol::Builder(UCodePointUnknown));
+    PoincareHelpers::Simplify(&m_expressionDerivate, context, ExpressionNode::ReductionTarget::SystemForApproximation);
+    // simplify might return an uninitialized Expression if interrupted
+    if (m_expressionDerivate.isUninitialized()) {
+      m_expressionDerivate = Poincare::Derivative::Builder(expressionReduced(record, context).clone(), Symbol::Builder(UCodePointUnknown), Symbol::Builder(UCodePointUnknown));
+    }
+  }
+  return m_expressionDerivate;
+}
+
+Poincare::Expression ContinuousFunction::Model::expressionForApproximation(const ContinuousFunction * function, Poincare::Context * context) const {
+  if (m_expressionForApproximation.isUninitialized()) {
+    m_expressionForApproximation = PoincareHelpers::ApproximateKeepingSymbols(function->expressionReduced(context).clone(), context);
+  }
+  return m_expressionForApproximation;
+}
+
+void ContinuousFunction::Model::tidy() const {
+  m_expressionDerivate = Poincare::Expression();
+  m_expressionForApproximation = Poincare::Expression();
+  ExpressionModel::tidy();
+}
+
 ContinuousFunction::RecordDataBuffer * ContinuousFunction::recordData() const {
   assert(!isNull());
   Ion::Storage::Record::Data d = value();
@@ -280,7 +314,7 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincar
   char unknown[bufferSize];
   Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
   PlotType type = plotType();
-  Expression e = expressionReduced(context);
+  Expression e = m_model.expressionForApproximation(this, context);
   if (type != PlotType::Parametric) {
     assert(type == PlotType::Cartesian || type == PlotType::Polar);
     return Coordinate2D<T>(t, PoincareHelpers::ApproximateWithValueForSymbol(e, unknown, t, context));
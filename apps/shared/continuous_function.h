@@ -48,6 +48,9 @@ public:
   Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context) const override {
     return privateEvaluateXYAtParameter<double>(t, context);
   }
+  /* Bounds the values of a cartesian function between tMin and tMax. The
+   * enclosure is Unknown for other plot types. */
+  Poincare::Enclosure enclosureOnRange(float tMin, float tMax, Poincare::Context * context) const;
 
   // Derivative
   bool displayDerivative() const;
@@ -106,9 +109,18 @@ private:
     //char m_expression[0];
   };
   class Model : public ExpressionModel {
+  public:
+    // The derivative is reduced once and then approximated for each abscissa
+    Poincare::Expression expressionDerivateReduced(const Ion::Storage::Record * record, Poincare::Context * context) const;
+    /* The subtrees of the reduced expression that do not depend on the
+     * parameter are approximated once and then reused for each parameter */
+    Poincare::Expression expressionForApproximation(const ContinuousFunction * function, Poincare::Context * context) const;
+    void tidy() const override;
   private:
     void * expressionAddress(const Ion::Storage::Record * record) const override;
     size_t expressionSize(const Ion::Storage::Record * record) const override;
+    mutable Poincare::Expression m_expressionDerivate;
+    mutable Poincare::Expression m_expressionForApproximation;
   };
   size_t metaDataSize() const override { return sizeof(RecordDataBuffer); }
   const ExpressionModel * model() const override { return &m_model; }
@@ -595,7 +595,7 @@ const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
 
 constexpr static int k_maxNumberOfIterations = 10;
 
-void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound) const {
+void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EncloseYForXRange yEnclosure) const {
   float previousT = NAN;
   float t = NAN;
   float previousX = NAN;
@@ -623,11 +623,14 @@ void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd
     if (colorUnderCurve && !std::isnan(x) && colorLowerBound < x && x < colorUpperBound && !(std::isnan(y) || std::isinf(y))) {
       drawHorizontalOrVerticalSegment(ctx, rect, Axis::Vertical, x, std::min(0.0f, y), std::max(0.0f, y), color, 1);
     }
+    if (yEnclosure != nullptr && joinDotsWithinEnclosure(ctx, rect, yEnclosure, model, context, previousT, previousX, previousY, t, x, y, color, thick)) {
+      continue;
+    }
     joinDots(ctx, rect, xyEvaluation, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, color, thick, k_maxNumberOfIterations);
   } while (true);
 }
 
-void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound) const {
+void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EncloseYForXRange yEnclosure) const {
   float rectLeft = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
   float rectRight = pixelToFloat(Axis::Horizontal, rect.right() + k_externRectMargin);
   float tStart = std::isnan(rectLeft) ? xMin : std::max(xMin, rectLeft);
@@ -637,7 +640,7 @@ void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, flo
     return;
   }
   float tStep = pixelWidth();
-  drawCurve(ctx, rect, tStart, tEnd, tStep, xyEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound);
+  drawCurve(ctx, rect, tStart, tEnd, tStep, xyEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound, yEnclosure);
 }
 
 void CurveView::drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
@@ -723,6 +726,42 @@ void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForParameter xy
   }
 }
 
+bool CurveView::joinDotsWithinEnclosure(KDContext * ctx, KDRect rect, EncloseYForXRange yEnclosure, void * model, void * context, float t, float x, float y, float s, float u, float v, KDColor color, bool thick) const {
+  if (std::isnan(t)) {
+    // The first dot has to be stamped
+    return false;
+  }
+  Poincare::Enclosure enclosure = yEnclosure(t, s, model, context);
+  if (enclosure.isDiscontinuous()) {
+    /* The curve may jump or diverge between the dots: joining them would draw
+     * a vertical line at the discontinuity, and the dichotomy would only get
+     * closer to it. Only the right dot is drawn. */
+    if (std::isfinite(u) && std::isfinite(v)) {
+      stampAtLocation(ctx, rect, floatToPixel(Axis::Horizontal, u), floatToPixel(Axis::Vertical, v), color, thick);
+    }
+    return true;
+  }
+  if (!enclosure.isContinuous() || !std::isfinite(y) || !std::isfinite(v)) {
+    // Undefined dots need the dichotomy
+    return false;
+  }
+  float pxf = floatToPixel(Axis::Horizontal, x);
+  float pyf = floatToPixel(Axis::Vertical, y);
+  float puf = floatToPixel(Axis::Horizontal, u);
+  float pvf = floatToPixel(Axis::Vertical, v);
+  float enclosurePixelMin = std::min(floatToPixel(Axis::Vertical, enclosure.lower()), floatToPixel(Axis::Vertical, enclosure.upper()));
+  float enclosurePixelMax = std::max(floatToPixel(Axis::Vertical, enclosure.lower()), floatToPixel(Axis::Vertical, enclosure.upper()));
+  /* The curve is continuous between the dots and never goes further than a
+   * dot radius away from the segment joining them: the segment is a faithful
+   * drawing of the curve. */
+  float radius = (thick ? thickCircleDiameter : thinCircleDiameter) / 2.0f;
+  if (enclosurePixelMin < std::min(pyf, pvf) - radius || enclosurePixelMax > std::max(pyf, pvf) + radius) {
+    return false;
+  }
+  straightJoinDots(ctx, rect, pxf, pyf, puf, pvf, color, thick);
+  return true;
+}
+
 static void clipBarycentricCoordinatesBetweenBounds(float & start, float & end, const KDCoordinate * bounds, const float p1f, const float p2f) {
   static constexpr int lower = 0;
   static constexpr int upper = 1;
@@ -7,6 +7,7 @@
 #include "cursor_view.h"
 #include <poincare/preferences.h>
 #include <poincare/coordinate_2D.h>
+#include <poincare/enclosure.h>
 #include <cmath>
 
 namespace Shared {
@@ -18,6 +19,7 @@ public:
   static constexpr float k_labelsHorizontalMarginRatio = 0.066f;
   typedef Poincare::Coordinate2D<float> (*EvaluateXYForParameter)(float t, void * model, void * context);
   typedef float (*EvaluateYForX)(float x, void * model, void * context);
+  typedef Poincare::Enclosure (*EncloseYForXRange)(float xMin, float xMax, void * model, void * context);
   enum class Axis {
     Horizontal = 0,
     Vertical = 1
@@ -106,8 +108,11 @@ protected:
   void drawGrid(KDContext * ctx, KDRect rect) const;
   void drawAxes(KDContext * ctx, KDRect rect) const;
   void drawAxis(KDContext * ctx, KDRect rect, Axis axis) const;
-  void drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f) const;
-  void drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f) const;
+  /* yEnclosure is only relevant to cartesian curves (where x = t). When
+   * provided, it is used to join consecutive dots without sampling the curve
+   * between them whenever the enclosure proves that it is not needed. */
+  void drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EncloseYForXRange yEnclosure = nullptr) const;
+  void drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForParameter xyEvaluation, void * model, void * context, KDColor color, bool thick = true, bool colorUnderCurve = false, float colorLowerBound = 0.0f, float colorUpperBound = 0.0f, EncloseYForXRange yEnclosure = nullptr) const;
   void drawHistogram(KDContext * ctx, KDRect rect, EvaluateYForX yEvaluation, void * model, void * context, float firstBarAbscissa, float barWidth,
     bool fillBar, KDColor defaultColor, KDColor highlightColor,  float highlightLowerBound = INFINITY, float highlightUpperBound = -INFINITY) const;
   void computeLabels(Axis axis);
@@ -138,6 +143,11 @@ private:
   /* Recursively join two dots (dichotomy). The method stops when the
    * maxNumberOfRecursion in reached. */
   void joinDots(KDContext * ctx, KDRect rect, EvaluateXYForParameter xyEvaluation, void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, KDColor color, bool thick, int maxNumberOfRecursion) const;
+  /* Join two dots with a straight line if the enclosure of the curve between
+   * them proves that the line stays within a dot radius of the curve, and
+   * leave them apart if it proves that the curve may be discontinuous between
+   * them. Returns false if the dots still have to be joined. */
+  bool joinDotsWithinEnclosure(KDContext * ctx, KDRect rect, EncloseYForXRange yEnclosure, void * model, void * context, float t, float x, float y, float s, float u, float v, KDColor color, bool thick) const;
   /* Join two dots with a straight line. */
   void straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float pyf, float puf, float pvf, KDColor color, bool thick) const;
   /* Stamp centered around (pxf, pyf). If pxf and pyf are not round number, the
@@ -1,6 +1,7 @@
 #include "expression_model.h"
 #include "global_context.h"
 #include "poincare_helpers.h"
+#include "reduction_cache.h"
 #include <apps/apps_container.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/undefined.h>
@@ -69,6 +70,11 @@ Expression ExpressionModel::expressionReduced(const Storage::Record * record, Po
    */
   if (m_expression.isUninitialized()) {
     assert(record->fullName() != nullptr);
+    ReductionCache * cache = ReductionCache::sharedCache();
+    m_expression = cache->reducedExpression(expressionAddress(record), expressionSize(record), context);
+    if (!m_expression.isUninitialized()) {
+      return m_expression;
+    }
     if (isCircularlyDefined(record, context)) {
       m_expression = Undefined::Builder();
     } else {
@@ -77,8 +83,10 @@ Expression ExpressionModel::expressionReduced(const Storage::Record * record, Po
       // simplify might return an uninitialized Expression if interrupted
       if (m_expression.isUninitialized()) {
         m_expression = Expression::ExpressionFromAddress(expressionAddress(record), expressionSize(record));
+        return m_expression;
       }
     }
+    cache->setReducedExpression(expressionAddress(record), expressionSize(record), context, m_expression);
   }
   return m_expression;
 }
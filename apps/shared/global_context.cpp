@@ -69,6 +69,49 @@ void GlobalContext::setExpressionForSymbolAbstract(const Expression & expression
   }
 }
 
+bool GlobalContext::approximationForSymbol(const Symbol & symbol, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool doublePrecision, double * value) {
+  uint32_t storageChangeCount = Ion::Storage::sharedStorage()->changeCount();
+  if (storageChangeCount != m_storageChangeCount) {
+    m_storageChangeCount = storageChangeCount;
+    m_numberOfApproximatedSymbols = 0;
+    m_nextApproximatedSymbol = 0;
+  }
+  for (int i = 0; i < m_numberOfApproximatedSymbols; i++) {
+    const ApproximatedSymbol & s = m_approximatedSymbols[i];
+    if (s.complexFormat == complexFormat && s.angleUnit == angleUnit && s.doublePrecision == doublePrecision && strcmp(s.name, symbol.name()) == 0) {
+      *value = s.value;
+      return s.isMemoizable;
+    }
+  }
+
+  ApproximatedSymbol & s = m_approximatedSymbols[m_nextApproximatedSymbol];
+  m_nextApproximatedSymbol = (m_nextApproximatedSymbol + 1) % k_maxNumberOfApproximatedSymbols;
+  m_numberOfApproximatedSymbols = m_numberOfApproximatedSymbols < k_maxNumberOfApproximatedSymbols ? m_numberOfApproximatedSymbols + 1 : k_maxNumberOfApproximatedSymbols;
+  strlcpy(s.name, symbol.name(), sizeof(s.name));
+  s.complexFormat = complexFormat;
+  s.angleUnit = angleUnit;
+  s.doublePrecision = doublePrecision;
+  s.isMemoizable = false;
+  s.value = NAN;
+  Ion::Storage::Record r = SymbolAbstractRecordWithBaseName(symbol.name());
+  Expression e = ExpressionForActualSymbol(r);
+  if (!e.isUninitialized()) {
+    e = Expression::ExpressionWithoutSymbols(e, this);
+  }
+  /* Only memoize real approximations that depend on nothing but the storage:
+   * the expanded expression may still contain symbols defined by a
+   * VariableContext, or random nodes that have to be drawn at each call. */
+  if (!e.isUninitialized() && !e.recursivelyMatches([](const Expression e, Context * context) {
+          return e.type() == ExpressionNode::Type::Symbol || e.type() == ExpressionNode::Type::Function || e.isRandom();
+        }, this, ExpressionNode::SymbolicComputation::DoNotReplaceAnySymbol))
+  {
+    s.value = doublePrecision ? e.approximateToScalar<double>(this, complexFormat, angleUnit) : e.approximateToScalar<float>(this, complexFormat, angleUnit);
+    s.isMemoizable = !std::isnan(s.value);
+  }
+  *value = s.value;
+  return s.isMemoizable;
+}
+
 const Expression GlobalContext::ExpressionForSymbolAndRecord(const SymbolAbstract & symbol, Ion::Storage::Record r) {
   if (symbol.type() == ExpressionNode::Type::Symbol) {
     return ExpressionForActualSymbol(r);
@@ -16,6 +16,8 @@ public:
   static constexpr int k_numberOfExtensions = 2;
   static constexpr const char * k_extensions[] = {Ion::Storage::expExtension, Ion::Storage::funcExtension};
 
+  GlobalContext() : m_numberOfApproximatedSymbols(0), m_nextApproximatedSymbol(0), m_storageChangeCount(0) {}
+
   // Storage information
   static bool SymbolAbstractNameIsFree(const char * baseName);
 
@@ -30,8 +32,27 @@ public:
   SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) override;
   const Poincare::Expression expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone) override;
   void setExpressionForSymbolAbstract(const Poincare::Expression & expression, const Poincare::SymbolAbstract & symbol) override;
+  bool approximationForSymbol(const Poincare::Symbol & symbol, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, bool doublePrecision, double * value) override;
 
 private:
+  /* Approximating a stored symbol requires to find its record in the storage,
+   * to deserialize its expression and to expand the symbols it depends on.
+   * The last approximations are thus memoized, until the storage changes. */
+  struct ApproximatedSymbol {
+    char name[Poincare::SymbolAbstract::k_maxNameSize];
+    Poincare::Preferences::ComplexFormat complexFormat;
+    Poincare::Preferences::AngleUnit angleUnit;
+    bool doublePrecision;
+    // False if the approximation does not only depend on the storage
+    bool isMemoizable;
+    double value;
+  };
+  static constexpr int k_maxNumberOfApproximatedSymbols = 8;
+  ApproximatedSymbol m_approximatedSymbols[k_maxNumberOfApproximatedSymbols];
+  int m_numberOfApproximatedSymbols;
+  int m_nextApproximatedSymbol;
+  uint32_t m_storageChangeCount;
+
   // Expression getters
   static const Poincare::Expression ExpressionForSymbolAndRecord(const Poincare::SymbolAbstract & symbol, Ion::Storage::Record r);
   static const Poincare::Expression ExpressionForActualSymbol(Ion::Storage::Record r);
@@ -49,6 +49,18 @@ inline T ApproximateWithValueForSymbol(const Poincare::Expression e, const char
   return e.approximateWithValueForSymbol<T>(symbol, x, context, complexFormat, preferences->angleUnit());
 }
 
+inline Poincare::Expression ApproximateKeepingSymbols(Poincare::Expression e, Poincare::Context * context) {
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  Poincare::Preferences::ComplexFormat complexFormat = Poincare::Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context);
+  return e.approximateKeepingSymbols(context, complexFormat, preferences->angleUnit());
+}
+
+inline Poincare::Enclosure EnclosureOnRange(const Poincare::Expression e, double xMin, double xMax, Poincare::Context * context) {
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  Poincare::Preferences::ComplexFormat complexFormat = Poincare::Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), e, context);
+  return e.enclosure(Poincare::Enclosure(xMin, xMax), context, complexFormat, preferences->angleUnit());
+}
+
 template <class T>
 inline T ApproximateToScalar(const char * text, Poincare::Context * context, Poincare::ExpressionNode::SymbolicComputation symbolicComputation = Poincare::ExpressionNode::SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition) {
   Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
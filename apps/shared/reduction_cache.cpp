@@ -0,0 +1,100 @@
+#include "reduction_cache.h"
+#include <ion.h>
+#include <assert.h>
+#include <string.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+ReductionCache * ReductionCache::sharedCache() {
+  static ReductionCache sCache;
+  return &sCache;
+}
+
+ReductionCache::ReductionCache() :
+  m_usedSize(0),
+  m_storageChangeCount(Ion::Storage::sharedStorage()->changeCount())
+{
+}
+
+Expression ReductionCache::reducedExpression(const void * expressionAddress, size_t expressionSize, Context * context) {
+  if (expressionSize == 0) {
+    return Expression();
+  }
+  resetIfStorageChanged();
+  EntryHeader key = HeaderForExpression(expressionAddress, expressionSize, context);
+  const char * entry = m_buffer;
+  while (entry < m_buffer + m_usedSize) {
+    EntryHeader header = HeaderAt(entry);
+    if (HeadersHaveSameKey(header, key)) {
+      return Expression::ExpressionFromAddress(entry + sizeof(EntryHeader), header.reducedExpressionSize);
+    }
+    entry += SizeOfEntry(header);
+  }
+  return Expression();
+}
+
+void ReductionCache::setReducedExpression(const void * expressionAddress, size_t expressionSize, Context * context, const Expression & reducedExpression) {
+  if (expressionSize == 0 || expressionSize > UINT16_MAX || reducedExpression.isUninitialized()) {
+    return;
+  }
+  resetIfStorageChanged();
+  EntryHeader header = HeaderForExpression(expressionAddress, expressionSize, context);
+  size_t reducedExpressionSize = reducedExpression.size();
+  if (sizeof(EntryHeader) + reducedExpressionSize > k_bufferSize) {
+    return;
+  }
+  header.reducedExpressionSize = reducedExpressionSize;
+  while (m_usedSize + SizeOfEntry(header) > k_bufferSize) {
+    removeOldestEntry();
+  }
+  char * entry = m_buffer + m_usedSize;
+  memcpy(entry, &header, sizeof(EntryHeader));
+  memcpy(entry + sizeof(EntryHeader), reducedExpression.addressInPool(), reducedExpressionSize);
+  m_usedSize += SizeOfEntry(header);
+}
+
+ReductionCache::EntryHeader ReductionCache::HeaderForExpression(const void * expressionAddress, size_t expressionSize, Context * context) {
+  Preferences * preferences = Preferences::sharedPreferences();
+  EntryHeader header;
+  header.expressionChecksum = Ion::crc32Byte(static_cast<const uint8_t *>(expressionAddress), expressionSize);
+  header.context = context;
+  header.expressionSize = expressionSize;
+  header.reducedExpressionSize = 0;
+  header.complexFormat = preferences->complexFormat();
+  header.angleUnit = preferences->angleUnit();
+  return header;
+}
+
+bool ReductionCache::HeadersHaveSameKey(const EntryHeader & h1, const EntryHeader & h2) {
+  return h1.expressionChecksum == h2.expressionChecksum
+    && h1.context == h2.context
+    && h1.expressionSize == h2.expressionSize
+    && h1.complexFormat == h2.complexFormat
+    && h1.angleUnit == h2.angleUnit;
+}
+
+ReductionCache::EntryHeader ReductionCache::HeaderAt(const char * entry) {
+  // Entries are not aligned in the buffer
+  EntryHeader header;
+  memcpy(&header, entry, sizeof(EntryHeader));
+  return header;
+}
+
+void ReductionCache::resetIfStorageChanged() {
+  uint32_t storageChangeCount = Ion::Storage::sharedStorage()->changeCount();
+  if (storageChangeCount != m_storageChangeCount) {
+    m_storageChangeCount = storageChangeCount;
+    reset();
+  }
+}
+
+void ReductionCache::removeOldestEntry() {
+  assert(m_usedSize > 0);
+  size_t oldestEntrySize = SizeOfEntry(HeaderAt(m_buffer));
+  memmove(m_buffer, m_buffer + oldestEntrySize, m_usedSize - oldestEntrySize);
+  m_usedSize -= oldestEntrySize;
+}
+
+}
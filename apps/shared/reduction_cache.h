@@ -0,0 +1,52 @@
+#ifndef SHARED_REDUCTION_CACHE_H
+#define SHARED_REDUCTION_CACHE_H
+
+#include <poincare/context.h>
+#include <poincare/expression.h>
+#include <poincare/preferences.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* Reducing the expression of a model can take a long time. Models memoize
+ * their reduced expression, but the stores forget their models at each app
+ * switch and each storage change. The reduced expressions are thus also
+ * copied here, out of the TreePool, so that going back to an app does not
+ * reduce all its functions again.
+ * An entry is keyed by the checksum of the unreduced expression, the context
+ * and the preferences the reduction depends on. The reduction also depends on
+ * the symbols defined in the storage, so the cache is emptied whenever the
+ * storage changes. When the buffer is full, the oldest entries are dropped. */
+
+class ReductionCache {
+public:
+  static ReductionCache * sharedCache();
+  ReductionCache();
+  // Returns an uninitialized expression if the reduction is not cached
+  Poincare::Expression reducedExpression(const void * expressionAddress, size_t expressionSize, Poincare::Context * context);
+  void setReducedExpression(const void * expressionAddress, size_t expressionSize, Poincare::Context * context, const Poincare::Expression & reducedExpression);
+  void reset() { m_usedSize = 0; }
+private:
+  constexpr static size_t k_bufferSize = 4096;
+  struct EntryHeader {
+    uint32_t expressionChecksum;
+    const Poincare::Context * context;
+    uint16_t expressionSize;
+    uint16_t reducedExpressionSize;
+    Poincare::Preferences::ComplexFormat complexFormat;
+    Poincare::Preferences::AngleUnit angleUnit;
+  };
+  static EntryHeader HeaderForExpression(const void * expressionAddress, size_t expressionSize, Poincare::Context * context);
+  static bool HeadersHaveSameKey(const EntryHeader & h1, const EntryHeader & h2);
+  static EntryHeader HeaderAt(const char * entry);
+  static size_t SizeOfEntry(const EntryHeader & header) { return sizeof(EntryHeader) + header.reducedExpressionSize; }
+  void resetIfStorageChanged();
+  void removeOldestEntry();
+  char m_buffer[k_bufferSize];
+  size_t m_usedSize;
+  uint32_t m_storageChangeCount;
+};
+
+}
+
+#endif
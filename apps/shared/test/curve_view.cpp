@@ -0,0 +1,81 @@
+#include <quiz.h>
+#include <kandinsky/framebuffer.h>
+#include <kandinsky/framebuffer_context.h>
+#include <cmath>
+#include "../curve_view.h"
+
+using namespace Poincare;
+using namespace Shared;
+
+constexpr KDCoordinate k_size = 101;
+
+class TestCurveViewRange : public CurveViewRange {
+public:
+  TestCurveViewRange(float xMin, float xMax, float yMin, float yMax) : m_xMin(xMin), m_xMax(xMax), m_yMin(yMin), m_yMax(yMax) {}
+  float xMin() const override { return m_xMin; }
+  float xMax() const override { return m_xMax; }
+  float yMin() const override { return m_yMin; }
+  float yMax() const override { return m_yMax; }
+private:
+  float m_xMin;
+  float m_xMax;
+  float m_yMin;
+  float m_yMax;
+};
+
+class TestCurveView : public CurveView {
+public:
+  TestCurveView(CurveViewRange * range) : CurveView(range) {
+    setFrame(KDRect(0, 0, k_size, k_size), false);
+  }
+  void drawCurve(KDContext * ctx, EvaluateXYForParameter xyEvaluation, EncloseYForXRange yEnclosure) const {
+    drawCartesianCurve(ctx, bounds(), curveViewRange()->xMin(), curveViewRange()->xMax(), xyEvaluation, nullptr, nullptr, KDColorBlack, true, false, 0.0f, 0.0f, yEnclosure);
+  }
+};
+
+static void draw_curve(KDColor * pixels, float xMin, float xMax, float yMin, float yMax, CurveView::EvaluateXYForParameter xyEvaluation, CurveView::EncloseYForXRange yEnclosure) {
+  for (int i = 0; i < k_size * k_size; i++) {
+    pixels[i] = KDColorWhite;
+  }
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_size, k_size));
+  KDFrameBufferContext context(&frameBuffer);
+  TestCurveViewRange range(xMin, xMax, yMin, yMax);
+  TestCurveView view(&range);
+  view.drawCurve(&context, xyEvaluation, yEnclosure);
+}
+
+static bool rect_is_blank(const KDColor * pixels, KDRect rect) {
+  for (int j = rect.top(); j <= rect.bottom(); j++) {
+    for (int i = rect.left(); i <= rect.right(); i++) {
+      if (pixels[j * k_size + i] != KDColorWhite) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(curve_view_discontinuities_are_not_joined) {
+  KDColor pixels[k_size * k_size];
+
+  // tan on [0, π]: the pole x = π/2 is in the column 50
+  draw_curve(pixels, 0.0f, M_PI, -10.0f, 10.0f,
+      [](float t, void * model, void * context) { return Coordinate2D<float>(t, std::tan(t)); },
+      [](float tMin, float tMax, void * model, void * context) {
+        Enclosure x(tMin, tMax);
+        return Enclosure::Multiply(Enclosure::Sine(x), Enclosure::Inverse(Enclosure::Cosine(x)));
+      });
+  // tan(π/4) = 1 is drawn in the row 45
+  quiz_assert(!rect_is_blank(pixels, KDRect(24, 44, 3, 3)));
+  quiz_assert(rect_is_blank(pixels, KDRect(48, 20, 5, 61)));
+
+  // floor on [-5, 5]: the jump from 0 to 1 at x = 1 is in the column 60
+  draw_curve(pixels, -5.0f, 5.0f, -2.0f, 2.0f,
+      [](float t, void * model, void * context) { return Coordinate2D<float>(t, std::floor(t)); },
+      [](float tMin, float tMax, void * model, void * context) {
+        return Enclosure::Floor(Enclosure(tMin, tMax));
+      });
+  // floor(0.5) = 0 is drawn in the row 50
+  quiz_assert(!rect_is_blank(pixels, KDRect(54, 49, 3, 3)));
+  quiz_assert(rect_is_blank(pixels, KDRect(58, 30, 5, 15)));
+}
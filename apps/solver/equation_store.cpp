@@ -9,13 +9,16 @@
 #include <poincare/symbol.h>
 #include <poincare/matrix.h>
 #include <poincare/rational.h>
+#include <poincare/real_part.h>
 #include <poincare/opposite.h>
 #include <poincare/addition.h>
 #include <poincare/subtraction.h>
 #include <poincare/multiplication.h>
 #include <poincare/division.h>
+#include <poincare/imaginary_part.h>
 #include <poincare/square_root.h>
 #include <poincare/power.h>
+#include <poincare/solver.h>
 #include <poincare/undefined.h>
 
 using namespace Poincare;
@@ -23,10 +26,13 @@ using namespace Shared;
 
 namespace Solver {
 
+static_assert(Expression::k_maxPolynomialDegree <= Poincare::Solver::k_maxPolynomialRootsDegree, "The polynomial roots solver cannot handle all the polynomial equations");
+
 EquationStore::EquationStore() :
   ExpressionModelStore(),
   m_type(Type::LinearSystem),
   m_numberOfSolutions(0),
+  m_polynomialDegree(0),
   m_exactSolutionExactLayouts{},
   m_exactSolutionApproximateLayouts{},
   m_numberOfUserVariables(0)
@@ -221,12 +227,17 @@ EquationStore::Error EquationStore::privateExactSolve(Poincare::Context * contex
           replaceFunctionsButNotSymbols ?
             ExpressionNode::SymbolicComputation::ReplaceDefinedFunctionsWithDefinitions :
             ExpressionNode::SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition);
+    m_polynomialDegree = degree;
     if (degree == 2) {
       // Polynomial degree <= 2
       m_type = Type::PolynomialMonovariable;
       error = oneDimensialPolynomialSolve(exactSolutions, exactSolutionsApproximations, polynomialCoefficients, degree, context);
+    } else if (degree > 2 && approximatePolynomialSolve(exactSolutions, exactSolutionsApproximations, polynomialCoefficients, degree, context)) {
+      // Polynomial degree > 2, all roots are approximated at once
+      m_type = Type::PolynomialMonovariable;
+      error = Error::NoError;
     } else {
-      // Step 4. Monovariable non-polynomial or polynomial with degree > 2
+      // Step 4. Monovariable non-polynomial or polynomial with non-numerical coefficients
       m_type = Type::Monovariable;
       m_intervalApproximateSolutions[0] = -10;
       m_intervalApproximateSolutions[1] = 10;
@@ -409,6 +420,39 @@ EquationStore::Error EquationStore::oneDimensialPolynomialSolve(Expression exact
 #endif
 }
 
+bool EquationStore::approximatePolynomialSolve(Expression exactSolutions[k_maxNumberOfExactSolutions], Expression exactSolutionsApproximations[k_maxNumberOfExactSolutions], Expression coefficients[Expression::k_maxNumberOfPolynomialCoefficients], int degree, Context * context) {
+  /* Beyond degree 2, the exact roots are either unreadable or not expressible
+   * with radicals, so all the complex roots are approximated at once. This
+   * requires numerical coefficients: PolynomialRoots fails on undefined ones. */
+  assert(degree > 2 && degree <= Expression::k_maxPolynomialDegree);
+  Preferences::ComplexFormat complexFormat = updatedComplexFormat(context);
+  Preferences::AngleUnit angleUnit = Preferences::sharedPreferences()->angleUnit();
+  std::complex<double> approximateCoefficients[Expression::k_maxNumberOfPolynomialCoefficients];
+  for (int i = 0; i <= degree; i++) {
+    approximateCoefficients[i] = std::complex<double>(
+        RealPart::Builder(coefficients[i].clone()).approximateToScalar<double>(context, complexFormat, angleUnit),
+        ImaginaryPart::Builder(coefficients[i].clone()).approximateToScalar<double>(context, complexFormat, angleUnit));
+  }
+  std::complex<double> roots[Expression::k_maxPolynomialDegree];
+  int numberOfRoots = Poincare::Solver::PolynomialRoots(approximateCoefficients, degree, roots);
+  if (numberOfRoots < 0) {
+    return false;
+  }
+  m_numberOfSolutions = 0;
+  for (int i = 0; i < numberOfRoots; i++) {
+    if (complexFormat == Preferences::ComplexFormat::Real && roots[i].imag() != 0.0) {
+      continue;
+    }
+    /* Real roots are displayed as in the Cartesian format, whatever complex
+     * values were encountered during the approximation. */
+    Preferences::ComplexFormat rootFormat = complexFormat == Preferences::ComplexFormat::Real ? Preferences::ComplexFormat::Cartesian : complexFormat;
+    exactSolutions[m_numberOfSolutions] = Complex<double>::Builder(roots[i]).complexToExpression(rootFormat);
+    exactSolutionsApproximations[m_numberOfSolutions] = exactSolutions[m_numberOfSolutions].clone();
+    m_numberOfSolutions++;
+  }
+  return true;
+}
+
 void EquationStore::tidySolution() {
   for (int i = 0; i < k_maxNumberOfExactSolutions; i++) {
     m_exactSolutionExactLayouts[i] = Layout();
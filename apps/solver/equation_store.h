@@ -51,6 +51,11 @@ public:
   int numberOfSolutions() const {
     return m_numberOfSolutions;
   }
+  /* The discriminant of a quadratic equation is displayed after its
+   * solutions. */
+  bool hasDiscriminant() const {
+    return m_type == Type::PolynomialMonovariable && m_polynomialDegree == 2;
+  }
   /* Exact resolution */
   Error exactSolve(Poincare::Context * context, bool * replaceFunctionsButNotSymbols);
   /* The exact solutions are displayed in a table with 2 layouts: an exact
@@ -97,6 +102,7 @@ private:
   Error privateExactSolve(Poincare::Context * context, bool replaceFunctionsButNotSymbols);
   Error resolveLinearSystem(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression coefficients[k_maxNumberOfEquations][Poincare::Expression::k_maxNumberOfVariables], Poincare::Expression constants[k_maxNumberOfEquations], Poincare::Context * context);
   Error oneDimensialPolynomialSolve(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression polynomialCoefficients[Poincare::Expression::k_maxNumberOfPolynomialCoefficients], int degree, Poincare::Context * context);
+  bool approximatePolynomialSolve(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression polynomialCoefficients[Poincare::Expression::k_maxNumberOfPolynomialCoefficients], int degree, Poincare::Context * context);
   void tidySolution();
   bool isExplictlyComplex(Poincare::Context * context);
   Poincare::Preferences::ComplexFormat updatedComplexFormat(Poincare::Context * context);
@@ -106,7 +112,8 @@ private:
   char m_variables[Poincare::Expression::k_maxNumberOfVariables][Poincare::SymbolAbstract::k_maxNameSize];
   char m_userVariables[Poincare::Expression::k_maxNumberOfVariables][Poincare::SymbolAbstract::k_maxNameSize];
   int m_numberOfSolutions;
-  Poincare::Layout m_exactSolutionExactLayouts[k_maxNumberOfApproximateSolutions];
+  int m_polynomialDegree;
+  Poincare::Layout m_exactSolutionExactLayouts[k_maxNumberOfExactSolutions];
   Poincare::Layout m_exactSolutionApproximateLayouts[k_maxNumberOfExactSolutions];
   bool m_exactSolutionIdentity[k_maxNumberOfExactSolutions];
   bool m_exactSolutionEquality[k_maxNumberOfExactSolutions];
@@ -113,7 +113,7 @@ void SolutionsController::viewWillAppear() {
   if (m_equationStore->type() == EquationStore::Type::Monovariable) {
     m_contentView.setWarningMessages(I18n::Message::OnlyFirstSolutionsDisplayed0, I18n::Message::OnlyFirstSolutionsDisplayed1);
     requireWarning = m_equationStore->haveMoreApproximationSolutions(App::app()->localContext(), m_shouldReplaceFunctionsButNotSymbols);
-  } else if (m_equationStore->type() == EquationStore::Type::PolynomialMonovariable && m_equationStore->numberOfSolutions() == 1) {
+  } else if (m_equationStore->hasDiscriminant() && m_equationStore->numberOfSolutions() == 1) {
     assert(Preferences::sharedPreferences()->complexFormat() == Preferences::ComplexFormat::Real);
     m_contentView.setWarningMessages(I18n::Message::PolynomeHasNoRealSolution0, I18n::Message::PolynomeHasNoRealSolution1);
     requireWarning = true;
@@ -181,7 +181,7 @@ void SolutionsController::willDisplayCellAtLocation(HighlightCell * cell, int i,
     return;
   }
   if (i == 0) {
-    if (m_equationStore->type() == EquationStore::Type::PolynomialMonovariable && j == m_equationStore->numberOfSolutions()-1) {
+    if (m_equationStore->hasDiscriminant() && j == m_equationStore->numberOfSolutions()-1) {
       // Formula of the discriminant
       EvenOddExpressionCell * deltaCell = static_cast<EvenOddExpressionCell *>(cell);
       deltaCell->setLayout(m_delta2Layout);
@@ -333,7 +333,7 @@ int SolutionsController::typeAtLocation(int i, int j) {
     return k_messageCellType;
   }
   if (i == 0) {
-    if (m_equationStore->type() == EquationStore::Type::PolynomialMonovariable && j == m_equationStore->numberOfSolutions()-1) {
+    if (m_equationStore->hasDiscriminant() && j == m_equationStore->numberOfSolutions()-1) {
       return k_deltaCellType;
     }
     return k_symbolCellType;
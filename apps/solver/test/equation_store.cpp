@@ -26,11 +26,6 @@ QUIZ_CASE(equation_solve) {
   );
   assert_solves_to("(x-3)^2=0", {"x=3", "delta=0"});
 
-  /* TODO: Cubic
-   * x^3-4x^2+6x-24=0
-   * x^3+x^2+1=0
-   * x^3-3x-2=0 */
-
   // Linear System
   assert_solves_to_infinite_solutions("x+y=0");
   assert_solves_to({"x+y=0", "3x+y=-5"}, {"x=-5/2", "y=5/2"});
@@ -91,6 +86,20 @@ QUIZ_CASE(equation_solve) {
   assert_solves_numerically_to("conj(x)*x+1=0", -100, 100, {});
 }
 
+QUIZ_CASE(equation_solve_polynomial) {
+  // Polynomials of degree > 2 are solved numerically, without an interval
+  assert_solves_to("x^3-3x-2=0", {"x=-1", "x=2"});
+  assert_solves_to("x^3+x^2+1=0", "x=-1.465571");
+  assert_solves_to("x^10-1=0", {"x=-1", "x=1"});
+  assert_solves_to("(x-1)(x-2)(x-3)(x-4)(x-5)(x-6)(x-7)(x-8)(x-9)(x-10)=0", {"x=1", "x=2", "x=3", "x=4", "x=5", "x=6", "x=7", "x=8", "x=9", "x=10"});
+  assert_solves_to("x^5=x^3", {"x=-1", "x=0", "x=1"});
+  // Roots of high multiplicity
+  assert_solves_to("x^7-7x^6+21x^5-35x^4+35x^3-21x^2+7x-1=0", "x=1");
+  assert_solves_to("x^10-10x^9+45x^8-120x^7+210x^6-252x^5+210x^4-120x^3+45x^2-10x+1=0", "x=1");
+  assert_solves_to("x^6-6x^5+15x^4-20x^3+15x^2-6x+1=0", "x=1");
+  assert_solves_to_error("x^11=1", RequireApproximateSolution);
+}
+
 QUIZ_CASE(equation_solve_complex_real) {
   set_complex_format(Real);
   assert_solves_to("x+𝐢=0", "x=-𝐢"); // We still want complex solutions if the input has some complex value
@@ -99,6 +108,8 @@ QUIZ_CASE(equation_solve_complex_real) {
   assert_solves_to_error("x^2-√(-1)=0", EquationUnreal);
   assert_solves_to_error("x+√(-1)×√(-1)=0", EquationUnreal);
   assert_solves_to("root(-8,3)*x+3=0", "x=3/2");
+  assert_solves_to("x^3-4x^2+6x-24=0", "x=4");
+  assert_solves_to_no_solution("x^4+1=0");
   reset_complex_format();
 }
 
@@ -110,6 +121,8 @@ QUIZ_CASE(equation_solve_complex_cartesian) {
   assert_solves_to("x^2-√(-1)=0", {"x=-√(2)/2-(√(2)/2)𝐢", "x=√(2)/2+(√(2)/2)𝐢", "delta=4𝐢"});
   assert_solves_to("x+√(-1)×√(-1)=0", "x=1");
   assert_solves_to("root(-8,3)*x+3=0", "x=-3/4+(3√(3)/4)*𝐢");
+  assert_solves_to("x^3-4x^2+6x-24=0", {"x=-2.44949𝐢", "x=2.44949𝐢", "x=4"});
+  assert_solves_to("x^3+x^2+1=0", {"x=-1.465571", "x=0.2327856-0.792552𝐢", "x=0.2327856+0.792552𝐢"});
   reset_complex_format();
 }
 
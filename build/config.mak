@@ -11,6 +11,9 @@ EPSILON_APPS ?= calculation reader graph code statistics probability solver atom
 EPSILON_I18N ?= fr
 EPSILON_GETOPT ?= 0
 EPSILON_TELEMETRY ?= 0
+# Size in bytes of the MicroPython heap, which is part of the Code app memory
+EPSILON_PYTHON_HEAP_SIZE ?= 32768
 ESCHER_LOG_EVENTS_BINARY ?= 0
+ESCHER_LOG_EVENTS_JOURNAL ?= 0
 THEME_NAME ?= omega_light
 THEME_REPO ?= local
@@ -7,7 +7,9 @@ ifdef OMEGA_USERNAME
 endif
 SFLAGS += -DEPSILON_GETOPT=$(EPSILON_GETOPT)
 SFLAGS += -DEPSILON_TELEMETRY=$(EPSILON_TELEMETRY)
+SFLAGS += -DEPSILON_PYTHON_HEAP_SIZE=$(EPSILON_PYTHON_HEAP_SIZE)
 SFLAGS += -DESCHER_LOG_EVENTS_BINARY=$(ESCHER_LOG_EVENTS_BINARY)
+SFLAGS += -DESCHER_LOG_EVENTS_JOURNAL=$(ESCHER_LOG_EVENTS_JOURNAL)
 
 # Language-specific flags
 CFLAGS = -std=c99
@@ -19,7 +19,7 @@ $(BUILD_DIR)/libepsilon_%.o: $(call object_for,$(libepsilon_src)) $(BUILD_DIR)/i
 	@echo "LD      $@"
 	$(Q) $(LD) $^ $(LDFLAGS) -r -s -o $@
 
-$(BUILD_DIR)/compare: $(call object_for,ion/src/blackbox/compare.cpp)
+$(BUILD_DIR)/compare: $(call object_for,ion/src/blackbox/compare.cpp ion/src/shared/crc32_eat_byte.cpp)
 	@echo "LD      $@"
 	$(Q) $(LD) $^ $(BUILD_DIR)/libepsilon_first.o $(BUILD_DIR)/libepsilon_second.o $(LDFLAGS) -L. -o $@
 
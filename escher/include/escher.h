@@ -36,6 +36,7 @@
 #include <escher/layout_field.h>
 #include <escher/layout_field_delegate.h>
 #include <escher/list_view_data_source.h>
+#include <escher/memoized_list_view_data_source.h>
 #include <escher/message_table_cell.h>
 #include <escher/message_table_cell_with_buffer.h>
 #include <escher/message_table_cell_with_chevron.h>
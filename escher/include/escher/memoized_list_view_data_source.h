@@ -0,0 +1,34 @@
+#ifndef ESCHER_MEMOIZED_LIST_VIEW_DATA_SOURCE_H
+#define ESCHER_MEMOIZED_LIST_VIEW_DATA_SOURCE_H
+
+#include <escher/list_view_data_source.h>
+
+/* MemoizedListViewDataSource keeps the cumulated heights of the first rows in
+ * a prefix-sum array. Laying out or scrolling the list then neither asks for
+ * the height of all the rows above the visible ones, nor walks them to find
+ * the row at a given offset (a binary search is used instead).
+ * The offsets are computed lazily from memoizedRowHeight. Subclasses must call
+ * rowHeightDidChange when the memoized height of a row changes, and
+ * resetMemoization when rows are inserted, deleted or reordered. */
+
+class MemoizedListViewDataSource : public ListViewDataSource {
+public:
+  MemoizedListViewDataSource();
+  KDCoordinate cumulatedHeightFromIndex(int j) override;
+  int indexFromCumulatedHeight(KDCoordinate offsetY) override;
+  void resetMemoization() { m_numberOfMemoizedRows = 0; }
+  void rowHeightDidChange(int j);
+protected:
+  /* The height of row j as taken into account in the memoized offsets. A data
+   * source whose row heights temporarily differ from it (for instance when the
+   * selected row is expanded) can correct the offsets in
+   * cumulatedHeightFromIndex. */
+  virtual KDCoordinate memoizedRowHeight(int j) { return rowHeight(j); }
+private:
+  // Offsets of rows beyond k_memoizedRowsCount are computed on the fly
+  constexpr static int k_memoizedRowsCount = 32;
+  KDCoordinate m_memoizedOffsets[k_memoizedRowsCount+1];
+  int m_numberOfMemoizedRows;
+};
+
+#endif
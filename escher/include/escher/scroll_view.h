@@ -111,6 +111,17 @@ protected:
 #endif
   View * m_contentView;
 private:
+  /* Scroll by moving on screen the pixels of the content that remain visible:
+   * only the uncovered strips and the areas that were already dirty are then
+   * redrawn. This is only possible if the screen is up to date in the frame
+   * of the scroll view and if no other view is drawn over it. */
+  bool contentPixelsCanBeMoved();
+  KDRect contentDirtyRect();
+  void moveContentPixels(KDPoint delta, KDRect previouslyDirtyRect);
+  static bool HierarchyLeavesRectUntouched(View * view, KDPoint absoluteOrigin, const View * ignoredView, KDRect absoluteRect, bool * ignoredViewWasFound);
+  static KDRect DirtyRectOfHierarchy(View * view);
+  static void ResetDirtyRectOfHierarchy(View * view);
+  static void MoveScreenPixels(KDRect source, KDPoint delta);
   ScrollViewDataSource * m_dataSource;
   int numberOfSubviews() const override { return 1 + const_cast<ScrollView *>(this)->decorator()->numberOfIndicators(); }
   View * subviewAtIndex(int index) override { return (index == 0) ? &m_innerView : decorator()->indicatorAtIndex(index); }
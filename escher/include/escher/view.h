@@ -27,6 +27,8 @@ namespace Shared {
 class View {
   // We only want Window to be able to invoke View::redraw
   friend class Window;
+  // ScrollView moves the pixels of its content on screen instead of redrawing them
+  friend class ScrollView;
   friend class TransparentView;
   friend class Shared::RoundCursorView;
 public:
@@ -64,7 +66,7 @@ protected:
    * to a view, it's really absolute pixels that count.
    *
    * That being said, what are the case of dirtyness that we know of?
-   *  - Scrolling -> well, everything has to be redrawn anyway
+   *  - Scrolling -> only the uncovered area, the rest can be moved on screen
    *  - Moving a cursor -> In that case, there's really a much more efficient way
    *  - ... and that's all I can think of.
    */
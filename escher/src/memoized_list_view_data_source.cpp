@@ -0,0 +1,52 @@
+#include <escher/memoized_list_view_data_source.h>
+
+MemoizedListViewDataSource::MemoizedListViewDataSource() :
+  ListViewDataSource(),
+  m_numberOfMemoizedRows(0)
+{
+  m_memoizedOffsets[0] = 0;
+}
+
+KDCoordinate MemoizedListViewDataSource::cumulatedHeightFromIndex(int j) {
+  int numberOfMemoizableRows = j < k_memoizedRowsCount ? j : k_memoizedRowsCount;
+  while (m_numberOfMemoizedRows < numberOfMemoizableRows) {
+    m_memoizedOffsets[m_numberOfMemoizedRows+1] = m_memoizedOffsets[m_numberOfMemoizedRows] + memoizedRowHeight(m_numberOfMemoizedRows);
+    m_numberOfMemoizedRows++;
+  }
+  int result = m_memoizedOffsets[numberOfMemoizableRows];
+  for (int k = numberOfMemoizableRows; k < j; k++) {
+    result += memoizedRowHeight(k);
+  }
+  return result;
+}
+
+int MemoizedListViewDataSource::indexFromCumulatedHeight(KDCoordinate offsetY) {
+  /* Same result as TableViewDataSource::indexFromCumulatedHeight: the index of
+   * the row containing the pixel just above offsetY. Offsets are increasing
+   * with the row index so the row is searched by dichotomy. */
+  if (offsetY == 0) {
+    return 0;
+  }
+  int numberOfRows = this->numberOfRows();
+  if (cumulatedHeightFromIndex(numberOfRows) < offsetY) {
+    return numberOfRows;
+  }
+  int lower = 0;
+  int upper = numberOfRows;
+  while (lower < upper) {
+    int middle = (lower + upper) / 2;
+    if (cumulatedHeightFromIndex(middle) < offsetY) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  return lower - 1;
+}
+
+void MemoizedListViewDataSource::rowHeightDidChange(int j) {
+  // The offset of row j does not depend on its own height
+  if (j < m_numberOfMemoizedRows) {
+    m_numberOfMemoizedRows = j < 0 ? 0 : j;
+  }
+}
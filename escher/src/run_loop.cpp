@@ -55,6 +55,21 @@ bool RunLoop::step() {
 #if ESCHER_LOG_EVENTS_BINARY
   Ion::Console::writeChar(static_cast<uint8_t>(event));
 #endif
+#if ESCHER_LOG_EVENTS_JOURNAL
+  /* Journal entries are the event followed by the number of milliseconds since
+   * the previous entry, as a little-endian uint32_t. The headless simulator
+   * replays them with --journal. */
+  if (event.isKeyboardEvent()) {
+    static uint64_t sLastEntryTime = 0;
+    uint64_t now = Ion::Timing::millis();
+    uint32_t delay = now - sLastEntryTime;
+    sLastEntryTime = now;
+    Ion::Console::writeChar(static_cast<uint8_t>(event));
+    for (int i = 0; i < 4; i++) {
+      Ion::Console::writeChar(static_cast<uint8_t>(delay >> (8*i)));
+    }
+  }
+#endif
 #if ESCHER_LOG_EVENTS_NAME
   const char * name = event.name();
   if (name == nullptr) {
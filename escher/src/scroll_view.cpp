@@ -1,5 +1,7 @@
 #include <escher/scroll_view.h>
 #include <escher/palette.h>
+#include <escher/window.h>
+#include <ion/display.h>
 #include <new>
 extern "C" {
 #include <assert.h>
@@ -151,8 +153,139 @@ void ScrollView::layoutSubviews(bool force) {
 }
 
 void ScrollView::setContentOffset(KDPoint offset, bool forceRelayout) {
+  KDPoint previousOffset = contentOffset();
   if (m_dataSource->setOffset(offset) || forceRelayout) {
+    /* The relayout marks the whole content as dirty, so what can be reused
+     * from the screen has to be assessed before. */
+    bool canMovePixels = !forceRelayout && contentPixelsCanBeMoved();
+    KDRect previouslyDirtyRect = canMovePixels ? contentDirtyRect() : KDRectZero;
+    KDRect previousInnerFrame = m_innerView.m_frame;
+    KDSize previousContentSize = m_contentView->bounds().size();
     layoutSubviews();
+    /* Moving the pixels is only relevant if the content has just been
+     * translated: the indicators might have resized the inner view. */
+    if (canMovePixels && m_innerView.m_frame == previousInnerFrame && m_contentView->bounds().size() == previousContentSize) {
+      moveContentPixels(previousOffset.translatedBy(contentOffset().opposite()), previouslyDirtyRect);
+    }
+  }
+}
+
+bool ScrollView::contentPixelsCanBeMoved() {
+  const Window * w = window();
+  if (w == nullptr) {
+    return false;
+  }
+  /* The window is the root of the displayed hierarchy. A view keeps its
+   * superview once removed from it, so the scroll view must also be found
+   * while walking the hierarchy down. */
+  View * root = const_cast<View *>(static_cast<const View *>(w));
+  bool scrollViewWasFound = false;
+  return HierarchyLeavesRectUntouched(root, root->m_frame.origin(), this, m_innerView.absoluteVisibleFrame(), &scrollViewWasFound) && scrollViewWasFound;
+}
+
+KDRect ScrollView::contentDirtyRect() {
+  // In the coordinates of the inner view
+  return DirtyRectOfHierarchy(&m_innerView).unionedWith(m_dirtyRect.translatedBy(m_innerView.m_frame.origin().opposite()));
+}
+
+void ScrollView::moveContentPixels(KDPoint delta, KDRect previouslyDirtyRect) {
+  KDRect visibleFrame = m_innerView.absoluteVisibleFrame();
+  KDRect movedFrame = visibleFrame.intersectedWith(visibleFrame.translatedBy(delta));
+  if (movedFrame.isEmpty()) {
+    // Nothing remains visible, the whole content is already dirty
+    return;
+  }
+  MoveScreenPixels(movedFrame.translatedBy(delta.opposite()), delta);
+  ResetDirtyRectOfHierarchy(&m_innerView);
+
+  KDPoint innerOrigin = m_innerView.absoluteOrigin().opposite();
+  KDRect visibleRect = visibleFrame.translatedBy(innerOrigin);
+  KDRect movedRect = movedFrame.translatedBy(innerOrigin);
+  // Uncovered strips
+  if (movedRect.top() > visibleRect.top()) {
+    m_innerView.markRectAsDirty(KDRect(visibleRect.left(), visibleRect.top(), visibleRect.width(), movedRect.top() - visibleRect.top()));
+  }
+  if (movedRect.bottom() < visibleRect.bottom()) {
+    m_innerView.markRectAsDirty(KDRect(visibleRect.left(), movedRect.bottom() + 1, visibleRect.width(), visibleRect.bottom() - movedRect.bottom()));
+  }
+  if (movedRect.left() > visibleRect.left()) {
+    m_innerView.markRectAsDirty(KDRect(visibleRect.left(), visibleRect.top(), movedRect.left() - visibleRect.left(), visibleRect.height()));
+  }
+  if (movedRect.right() < visibleRect.right()) {
+    m_innerView.markRectAsDirty(KDRect(movedRect.right() + 1, visibleRect.top(), visibleRect.right() - movedRect.right(), visibleRect.height()));
+  }
+  // The pixels waiting to be redrawn have moved with the content
+  m_innerView.markRectAsDirty(previouslyDirtyRect.translatedBy(delta).intersectedWith(m_innerView.bounds()));
+  /* The indicators are drawn over the content and have been moved with it:
+   * both the indicators and the content under their moved copy are redrawn. */
+  int indicatorsCount = decorator()->numberOfIndicators();
+  for (int index = 1; index <= indicatorsCount; index++) {
+    KDRect indicatorFrame = decorator()->indicatorAtIndex(index)->m_frame;
+    if (indicatorFrame.intersects(m_innerView.m_frame)) {
+      markRectAsDirty(indicatorFrame);
+      m_innerView.markRectAsDirty(indicatorFrame.translatedBy(m_innerView.m_frame.origin().opposite()).translatedBy(delta).intersectedWith(m_innerView.bounds()));
+    }
+  }
+}
+
+bool ScrollView::HierarchyLeavesRectUntouched(View * view, KDPoint absoluteOrigin, const View * ignoredView, KDRect absoluteRect, bool * ignoredViewWasFound) {
+  /* Views are drawn in the order of a depth-first traversal. The rect is left
+   * untouched if no view outside of ignoredView hierarchy is waiting to be
+   * redrawn in it, and if no view drawn after ignoredView overlaps it. */
+  if (view == ignoredView) {
+    *ignoredViewWasFound = true;
+    return true;
+  }
+  if (view->m_dirtyRect.translatedBy(absoluteOrigin).intersects(absoluteRect)) {
+    return false;
+  }
+  if (*ignoredViewWasFound && view->m_frame.movedTo(absoluteOrigin).intersects(absoluteRect)) {
+    return false;
+  }
+  int numberOfSubviews = view->numberOfSubviews();
+  for (int i = 0; i < numberOfSubviews; i++) {
+    View * subview = view->subview(i);
+    if (subview == nullptr) {
+      continue;
+    }
+    if (!HierarchyLeavesRectUntouched(subview, absoluteOrigin.translatedBy(subview->m_frame.origin()), ignoredView, absoluteRect, ignoredViewWasFound)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+KDRect ScrollView::DirtyRectOfHierarchy(View * view) {
+  KDRect result = view->m_dirtyRect;
+  int numberOfSubviews = view->numberOfSubviews();
+  for (int i = 0; i < numberOfSubviews; i++) {
+    View * subview = view->subview(i);
+    if (subview != nullptr) {
+      result = result.unionedWith(DirtyRectOfHierarchy(subview).translatedBy(subview->m_frame.origin()));
+    }
+  }
+  return result;
+}
+
+void ScrollView::ResetDirtyRectOfHierarchy(View * view) {
+  view->m_dirtyRect = KDRectZero;
+  int numberOfSubviews = view->numberOfSubviews();
+  for (int i = 0; i < numberOfSubviews; i++) {
+    View * subview = view->subview(i);
+    if (subview != nullptr) {
+      ResetDirtyRectOfHierarchy(subview);
+    }
+  }
+}
+
+void ScrollView::MoveScreenPixels(KDRect source, KDPoint delta) {
+  KDColor line[Ion::Display::Width];
+  assert(source.width() <= Ion::Display::Width);
+  for (int k = 0; k < source.height(); k++) {
+    // Start with the lines at the destination end so that none is overwritten before being moved
+    KDCoordinate y = delta.y() > 0 ? source.bottom() - k : source.top() + k;
+    Ion::Display::pullRect(KDRect(source.left(), y, source.width(), 1), line);
+    Ion::Display::pushRect(KDRect(source.left() + delta.x(), y + delta.y(), source.width(), 1), line);
   }
 }
 
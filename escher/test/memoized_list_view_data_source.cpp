@@ -0,0 +1,50 @@
+#include <quiz.h>
+#include <escher.h>
+
+/* Rows of different heights, some of them empty. There are more rows than
+ * memoized offsets to check the offsets computed on the fly. */
+class VariableHeightDataSource : public MemoizedListViewDataSource {
+public:
+  VariableHeightDataSource() : m_firstShiftedRow(0), m_shift(0) {}
+  int numberOfRows() const override { return k_numberOfRows; }
+  KDCoordinate rowHeight(int j) override { return j % 5 == 3 ? 0 : 10 + (j * 7 + (j >= m_firstShiftedRow ? m_shift : 0)) % 13; }
+  HighlightCell * reusableCell(int index, int type) override { return nullptr; }
+  int reusableCellCount(int type) override { return 0; }
+  int typeAtLocation(int i, int j) override { return 0; }
+  void setShift(int firstShiftedRow, int shift) {
+    m_firstShiftedRow = firstShiftedRow;
+    m_shift = shift;
+  }
+  constexpr static int k_numberOfRows = 50;
+private:
+  int m_firstShiftedRow;
+  int m_shift;
+};
+
+void assert_memoized_offsets_are_exact(VariableHeightDataSource * dataSource) {
+  KDCoordinate totalHeight = 0;
+  for (int j = 0; j <= VariableHeightDataSource::k_numberOfRows; j++) {
+    quiz_assert(dataSource->cumulatedHeightFromIndex(j) == dataSource->TableViewDataSource::cumulatedHeightFromIndex(j));
+    if (j < VariableHeightDataSource::k_numberOfRows) {
+      totalHeight += dataSource->rowHeight(j);
+    }
+  }
+  for (KDCoordinate offset = -1; offset <= totalHeight + 1; offset++) {
+    quiz_assert(dataSource->indexFromCumulatedHeight(offset) == dataSource->TableViewDataSource::indexFromCumulatedHeight(offset));
+  }
+}
+
+QUIZ_CASE(escher_memoized_list_view_data_source) {
+  VariableHeightDataSource dataSource;
+  assert_memoized_offsets_are_exact(&dataSource);
+  // Change the height of the rows from the 20th one
+  dataSource.setShift(20, 3);
+  for (int j = 20; j < VariableHeightDataSource::k_numberOfRows; j++) {
+    dataSource.rowHeightDidChange(j);
+  }
+  assert_memoized_offsets_are_exact(&dataSource);
+  // Change the height of all rows
+  dataSource.setShift(0, 5);
+  dataSource.resetMemoization();
+  assert_memoized_offsets_are_exact(&dataSource);
+}
@@ -56,6 +56,10 @@ bool stackSafe();
 // Collect registers in a buffer and returns the stack pointer
 uintptr_t collectRegisters(jmp_buf regs);
 
+/* Makes the machine code just written in RAM executable. Returns false if the
+ * platform cannot execute code from RAM. */
+bool makeExecutable(void * address, size_t size);
+
 }
 
 #endif
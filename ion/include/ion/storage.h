@@ -98,6 +98,9 @@ public:
   // Delegate
   void setDelegate(StorageDelegate * delegate) { m_delegate = delegate; }
   void notifyChangeToDelegate(const Record r = Record()) const;
+  /* Incremented at each notified change: memoizations that are not the
+   * delegate can compare it to know if the storage changed. */
+  uint32_t changeCount() const { return m_changeCount; }
   Record::ErrorStatus notifyFullnessToDelegate() const;
 
   int numberOfRecordsWithExtension(const char * extension);
@@ -186,6 +189,7 @@ private:
   StorageDelegate * m_delegate;
   mutable Record m_lastRecordRetrieved;
   mutable char * m_lastRecordRetrievedPointer;
+  mutable uint32_t m_changeCount;
 };
 
 /* Some apps memoize records and need to be notified when a record might have
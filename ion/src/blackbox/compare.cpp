@@ -14,6 +14,9 @@
  * To compare the versions on a given scenario:
  *      make -j8 PLATFORM=blackbox compare
  *      ./build/release/blackbox/compare < path/to/scenario
+ * To compare the versions on all the scenarios (*.esc) of a folder, running 8
+ * of them at a time:
+ *      ./build/release/blackbox/compare --batch path/to/folder --jobs 8
  * To fuzz over scenarios that are in a folder named "tests":
  *      make -j8 PLATFORM=blackbox TOOLCHAIN=afl compare_fuzz
  */
@@ -26,9 +29,32 @@
 #include "library.h"
 
 #include <ion.h>
+#include <algorithm>
+#include <string>
 #include <thread>
+#include <vector>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
-int main(int argc, char * argv[]) {
+constexpr size_t k_frameBufferSize = sizeof(KDColor) * Ion::Display::Width * Ion::Display::Height;
+
+static uint32_t frameBufferCRC32(const KDColor * frameBuffer) {
+  const uint8_t * data = reinterpret_cast<const uint8_t *>(frameBuffer);
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < k_frameBufferSize; i++) {
+    crc = Ion::crc32EatByte(crc, data[i]);
+  }
+  return crc;
+}
+
+/* Plays the events of input on both versions in lock step. Returns the index of
+ * the first event after which the frames differ, or 0 if they never do. The
+ * frames are only written to PNG files when they differ. */
+static int compareScenario(FILE * input, const char * firstPNG, const char * secondPNG, uint32_t * finalCRC) {
   std::thread first(first_epsilon_main);
   std::thread second(second_epsilon_main);
 
@@ -37,7 +63,7 @@ int main(int argc, char * argv[]) {
 
   int index = 0;
   while (true) {
-    int e = getchar();
+    int e = getc(input);
     index++;
 
     first_epsilon_send_event(e);
@@ -50,15 +76,121 @@ int main(int argc, char * argv[]) {
     first_epsilon_wait_event_processed();
     second_epsilon_wait_event_processed();
 
-    if (memcmp(firstFrameBuffer, secondFrameBuffer, sizeof(KDColor) * Ion::Display::Width * Ion::Display::Height) != 0) {
-      printf("Framebuffer mismatch at index %d\n", index);
-      first_epsilon_write_frame_buffer_to_file("epsilon_first.png");
-      second_epsilon_write_frame_buffer_to_file("epsilon_second.png");
-      exit(-1);
+    /* A memcmp is cheaper than hashing both frames, so hashes are only
+     * computed once, for the report. */
+    if (memcmp(firstFrameBuffer, secondFrameBuffer, k_frameBufferSize) != 0) {
+      first_epsilon_write_frame_buffer_to_file(firstPNG);
+      second_epsilon_write_frame_buffer_to_file(secondPNG);
+      // The caller exits right away, there is no need to finish the scenario
+      first.detach();
+      second.detach();
+      return index;
     }
   }
 
   first.join();
   second.join();
+  *finalCRC = frameBufferCRC32(firstFrameBuffer);
+  return 0;
+}
+
+static bool hasScenarioExtension(const char * name) {
+  constexpr char k_extension[] = ".esc";
+  size_t length = strlen(name);
+  size_t extensionLength = strlen(k_extension);
+  return length > extensionLength && strcmp(name + length - extensionLength, k_extension) == 0;
+}
+
+/* Both versions keep their state in static memory, so a scenario can only be
+ * played once per process. Each scenario is therefore run in its own forked
+ * process, jobs of them at a time. */
+static int compareFolder(const char * folder, int jobs) {
+  DIR * dir = opendir(folder);
+  if (dir == nullptr) {
+    printf("Could not open %s\n", folder);
+    return -1;
+  }
+  std::vector<std::string> scenarios;
+  while (struct dirent * entry = readdir(dir)) {
+    if (hasScenarioExtension(entry->d_name)) {
+      scenarios.push_back(entry->d_name);
+    }
+  }
+  closedir(dir);
+  std::sort(scenarios.begin(), scenarios.end());
+
+  std::vector<pid_t> pids(scenarios.size(), 0);
+  int numberOfMismatches = 0;
+  size_t next = 0;
+  int running = 0;
+  while (next < scenarios.size() || running > 0) {
+    if (next < scenarios.size() && running < jobs) {
+      fflush(stdout);
+      pid_t pid = fork();
+      if (pid == 0) {
+        std::string path = std::string(folder) + "/" + scenarios[next];
+        FILE * input = fopen(path.c_str(), "rb");
+        if (input == nullptr) {
+          printf("%s: could not open the scenario\n", scenarios[next].c_str());
+          _exit(2);
+        }
+        std::string firstPNG = scenarios[next] + ".first.png";
+        std::string secondPNG = scenarios[next] + ".second.png";
+        uint32_t crc = 0;
+        int mismatch = compareScenario(input, firstPNG.c_str(), secondPNG.c_str(), &crc);
+        if (mismatch > 0) {
+          printf("%s: framebuffer mismatch at index %d\n", scenarios[next].c_str(), mismatch);
+        } else {
+          printf("%s: OK (final frame CRC32 %08x)\n", scenarios[next].c_str(), crc);
+        }
+        fflush(stdout);
+        _exit(mismatch > 0 ? 1 : 0);
+      }
+      pids[next++] = pid;
+      running++;
+      continue;
+    }
+    int status;
+    pid_t pid = wait(&status);
+    if (pid < 0) {
+      break;
+    }
+    running--;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      for (size_t i = 0; i < pids.size(); i++) {
+        if (pids[i] == pid) {
+          if (!WIFEXITED(status)) {
+            printf("%s: crashed\n", scenarios[i].c_str());
+          }
+          break;
+        }
+      }
+      numberOfMismatches++;
+    }
+  }
+  printf("%d of %zu scenarios differ\n", numberOfMismatches, scenarios.size());
+  return numberOfMismatches > 0 ? -1 : 0;
+}
+
+int main(int argc, char * argv[]) {
+  const char * folder = nullptr;
+  int jobs = 1;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--batch") == 0 && argc > i+1) {
+      folder = argv[++i];
+    } else if (strcmp(argv[i], "--jobs") == 0 && argc > i+1) {
+      jobs = std::max(1, atoi(argv[++i]));
+    }
+  }
+  if (folder != nullptr) {
+    exit(compareFolder(folder, jobs));
+  }
+
+  uint32_t crc = 0;
+  int mismatch = compareScenario(stdin, "epsilon_first.png", "epsilon_second.png", &crc);
+  if (mismatch > 0) {
+    printf("Framebuffer mismatch at index %d\n", mismatch);
+    exit(-1);
+  }
   exit(0);
 }
@@ -0,0 +1,10 @@
+#include <ion.h>
+#include <drivers/cache.h>
+
+bool Ion::makeExecutable(void * address, size_t size) {
+  /* The RAM is executable, but the code may still be in the data cache, and
+   * stale instructions may be in the instruction cache. */
+  Device::Cache::cleanDCache();
+  Device::Cache::invalidateICache();
+  return true;
+}
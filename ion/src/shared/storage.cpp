@@ -132,6 +132,7 @@ uint32_t Storage::checksum() {
 void Storage::notifyChangeToDelegate(const Record record) const {
   m_lastRecordRetrieved = Record(nullptr);
   m_lastRecordRetrievedPointer = nullptr;
+  m_changeCount++;
   if (m_delegate != nullptr) {
     m_delegate->storageDidChangeForRecord(record);
   }
@@ -327,7 +328,8 @@ Storage::Storage() :
   m_magicFooter(Magic),
   m_delegate(nullptr),
   m_lastRecordRetrieved(nullptr),
-  m_lastRecordRetrievedPointer(nullptr)
+  m_lastRecordRetrievedPointer(nullptr),
+  m_changeCount(0)
 {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
@@ -3,7 +3,6 @@
 #include <assert.h>
 #include <ion/display.h>
 #include <SDL.h>
-#include <string.h>
 
 namespace Ion {
 namespace Simulator {
@@ -21,6 +20,8 @@ void init(SDL_Renderer * renderer) {
     Ion::Display::Width,
     Ion::Display::Height
   );
+  // The content of a new texture is undefined
+  Framebuffer::invalidate();
 }
 
 void quit() {
@@ -29,12 +30,13 @@ void quit() {
 }
 
 void draw(SDL_Renderer * renderer, SDL_Rect * rect) {
-  int pitch = 0;
-  void * pixels = nullptr;
-  SDL_LockTexture(sFramebufferTexture, nullptr, &pixels, &pitch);
-  assert(pitch == 2*Ion::Display::Width);
-  memcpy(pixels, Framebuffer::address(), sizeof(KDColor)*Ion::Display::Width*Ion::Display::Height);
-  SDL_UnlockTexture(sFramebufferTexture);
+  KDRect dirtyRect = Framebuffer::dirtyRect();
+  if (!dirtyRect.isEmpty()) {
+    SDL_Rect textureRect = {dirtyRect.x(), dirtyRect.y(), dirtyRect.width(), dirtyRect.height()};
+    const KDColor * pixels = Framebuffer::address() + dirtyRect.y() * Ion::Display::Width + dirtyRect.x();
+    SDL_UpdateTexture(sFramebufferTexture, &textureRect, pixels, sizeof(KDColor) * Ion::Display::Width);
+    Framebuffer::clearDirtyRect();
+  }
 
   SDL_RenderCopy(renderer, sFramebufferTexture, nullptr, rect);
 }
@@ -7,6 +7,8 @@ namespace Events {
 
 void dumpEventCount(int i);
 void logAfter(int numberOfEvents);
+void readJournal(bool enabled);
+void reportLatency(int frameBudgetMs);
 
 }
 }
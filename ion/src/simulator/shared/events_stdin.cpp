@@ -8,6 +8,7 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <chrono>
 
 void IonSimulatorEventsPushEvent(int eventNumber) {
 }
@@ -15,18 +16,86 @@ void IonSimulatorEventsPushEvent(int eventNumber) {
 static int sLogAfterNumberOfEvents = -1;
 static int sEventCount = 0;
 
+/* A journal is a stream of events, each followed by the number of
+ * milliseconds elapsed since the previous one, as a little-endian uint32_t.
+ * Journals are recorded by builds made with ESCHER_LOG_EVENTS_JOURNAL=1. */
+static bool sReadJournal = false;
+static uint64_t sRecordedTime = 0;
+
+/* The processing latency of an event is the time elapsed between the moment it
+ * is handed to the run loop and the moment the run loop asks for the next one.
+ * This covers the dispatch of the event and the redraw of the window. */
+typedef std::chrono::steady_clock Clock;
+static int sFrameBudgetMs = -1;
+static Clock::time_point sEventStart;
+static Ion::Events::Event sPendingEvent = Ion::Events::None;
+static uint64_t sPendingEventRecordedTime = 0;
+static int sNumberOfTimedEvents = 0;
+static int sNumberOfEventsOverBudget = 0;
+static uint64_t sTotalLatencyUs = 0;
+static uint64_t sMaxLatencyUs = 0;
+
+static bool readJournalDelay(uint32_t * delay) {
+  *delay = 0;
+  for (int i = 0; i < 4; i++) {
+    int c = getchar();
+    if (c == EOF) {
+      return false;
+    }
+    *delay |= static_cast<uint32_t>(c) << (8*i);
+  }
+  return true;
+}
+
+static void reportPendingEventLatency() {
+  if (sFrameBudgetMs < 0 || sPendingEvent == Ion::Events::None) {
+    return;
+  }
+  uint64_t latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - sEventStart).count();
+  bool overBudget = latencyUs > static_cast<uint64_t>(sFrameBudgetMs) * 1000;
+  sNumberOfTimedEvents++;
+  sTotalLatencyUs += latencyUs;
+  sMaxLatencyUs = latencyUs > sMaxLatencyUs ? latencyUs : sMaxLatencyUs;
+  if (overBudget) {
+    sNumberOfEventsOverBudget++;
+  }
+  printf("Event %d (%d) at %llums: %lluus%s\n",
+      sEventCount,
+      static_cast<uint8_t>(sPendingEvent),
+      static_cast<unsigned long long>(sPendingEventRecordedTime),
+      static_cast<unsigned long long>(latencyUs),
+      overBudget ? " over budget" : "");
+  sPendingEvent = Ion::Events::None;
+}
+
+static void reportLatencySummary() {
+  if (sFrameBudgetMs < 0 || sNumberOfTimedEvents == 0) {
+    return;
+  }
+  printf("Latency: mean %lluus, max %lluus, %d of %d events over the %dms budget\n",
+      static_cast<unsigned long long>(sTotalLatencyUs / sNumberOfTimedEvents),
+      static_cast<unsigned long long>(sMaxLatencyUs),
+      sNumberOfEventsOverBudget,
+      sNumberOfTimedEvents,
+      sFrameBudgetMs);
+}
+
 namespace Ion {
 namespace Events {
 
 Event getPlatformEvent() {
+  reportPendingEventLatency();
   Ion::Events::Event event = Ion::Events::None;
   while (!(event.isDefined() && event.isKeyboardEvent())) {
     int c = getchar();
-    if (c == EOF) {
+    uint32_t delay = 0;
+    if (c == EOF || (sReadJournal && !readJournalDelay(&delay))) {
       printf("Finished processing %d events\n", sEventCount);
+      reportLatencySummary();
       event = Ion::Events::Termination;
       break;
     }
+    sRecordedTime += delay;
     event = Ion::Events::Event(c);
   }
 #if EPSILON_SIMULATOR_HAS_LIBPNG
@@ -39,6 +108,11 @@ Event getPlatformEvent() {
 #endif
   }
 #endif
+  if (event != Ion::Events::Termination) {
+    sPendingEvent = event;
+    sPendingEventRecordedTime = sRecordedTime;
+    sEventStart = Clock::now();
+  }
   return event;
 }
 
@@ -57,6 +131,14 @@ void logAfter(int numberOfEvents) {
   sLogAfterNumberOfEvents = numberOfEvents;
 }
 
+void readJournal(bool enabled) {
+  sReadJournal = enabled;
+}
+
+void reportLatency(int frameBudgetMs) {
+  sFrameBudgetMs = frameBudgetMs;
+}
+
 }
 }
 }
@@ -0,0 +1,17 @@
+#include <ion.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+bool Ion::makeExecutable(void * address, size_t size) {
+#if defined(__linux__)
+  // Memory protection applies to whole pages
+  uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+  uintptr_t start = reinterpret_cast<uintptr_t>(address) & ~(pageSize - 1);
+  uintptr_t end = reinterpret_cast<uintptr_t>(address) + size;
+  return mprotect(reinterpret_cast<void *>(start), end - start, PROT_READ | PROT_WRITE | PROT_EXEC) == 0;
+#else
+  return false;
+#endif
+}
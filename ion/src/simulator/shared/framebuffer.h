@@ -9,6 +9,12 @@ namespace Framebuffer {
 
 const KDColor * address();
 void setActive(bool enabled);
+/* The dirty rect is the union of all the rects pushed since it was last
+ * cleared, clipped to the screen. It tells which part of the framebuffer has
+ * to be sent to the host display. */
+KDRect dirtyRect();
+void clearDirtyRect();
+void invalidate();
 void writeToFile(const char * filename);
 
 }
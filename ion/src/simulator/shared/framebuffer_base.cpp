@@ -7,14 +7,24 @@
  * the GPU's memory. Reading data back from a texture is not possible, so we
  * simply maintain a framebuffer in RAM since Ion::Display::pullRect expects to
  * be able to read pixel data back.
- * A side effect is that we rewrite the whole texture when redrawing the screen.
- * This might not be the most efficient way since sending pixels to the GPU is
- * rather expensive.
+ * Sending pixels to the GPU is rather expensive, so we keep track of the union
+ * of the rects drawn since the last refresh and only upload that part of the
+ * framebuffer to the texture.
  * This is also very useful when running headless because we can easily log the
  * framebuffer to a PNG file. */
 
 static KDColor sPixels[Ion::Display::Width * Ion::Display::Height];
 static bool sFrameBufferActive = true;
+static KDRect sDirtyRect = KDRect(0, 0, Ion::Display::Width, Ion::Display::Height);
+
+static void markDirty(KDRect r) {
+  r = r.intersectedWith(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height));
+  if (r.isEmpty()) {
+    return;
+  }
+  sDirtyRect = sDirtyRect.unionedWith(r);
+  Ion::Simulator::Main::setNeedsRefresh();
+}
 
 namespace Ion {
 namespace Display {
@@ -23,14 +33,14 @@ static KDFrameBuffer sFrameBuffer = KDFrameBuffer(sPixels, KDSize(Ion::Display::
 
 void pushRect(KDRect r, const KDColor * pixels) {
   if (sFrameBufferActive) {
-    Simulator::Main::setNeedsRefresh();
+    markDirty(r);
     sFrameBuffer.pushRect(r, pixels);
   }
 }
 
 void pushRectUniform(KDRect r, KDColor c) {
   if (sFrameBufferActive) {
-    Simulator::Main::setNeedsRefresh();
+    markDirty(r);
     sFrameBuffer.pushRectUniform(r, c);
   }
 }
@@ -56,6 +66,18 @@ void setActive(bool enabled) {
   sFrameBufferActive = enabled;
 }
 
+KDRect dirtyRect() {
+  return sDirtyRect;
+}
+
+void clearDirtyRect() {
+  sDirtyRect = KDRectZero;
+}
+
+void invalidate() {
+  markDirty(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height));
+}
+
 }
 }
 }
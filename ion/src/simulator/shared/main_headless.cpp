@@ -36,6 +36,10 @@ int main(int argc, char * argv[]) {
     if (strcmp(argv[i], "--logAfter") == 0 && argc > i+1) {
       Ion::Simulator::Framebuffer::setActive(true);
       Ion::Simulator::Events::logAfter(atoi(argv[i+1]));
+    } else if (strcmp(argv[i], "--journal") == 0) {
+      Ion::Simulator::Events::readJournal(true);
+    } else if (strcmp(argv[i], "--frameBudget") == 0 && argc > i+1) {
+      Ion::Simulator::Events::reportLatency(atoi(argv[i+1]));
     }
   }
 
@@ -29,6 +29,7 @@ private:
 
   // Simplification
   Expression shallowReduce(ReductionContext reductionContext) override;
+  Expression unaryFunctionDifferential(ReductionContext reductionContext) const override;
   LayoutShape leftLayoutShape() const override { return LayoutShape::MoreLetters; };
   LayoutShape rightLayoutShape() const override { return LayoutShape::BoundaryPunctuation; }
 
@@ -50,6 +51,7 @@ public:
   static constexpr Expression::FunctionHelper s_functionHelper = Expression::FunctionHelper("acos", 1, &UntypedBuilderOneChild<ArcCosine>);
 
   Expression shallowReduce(ExpressionNode::ReductionContext reductionContext);
+  Expression unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const;
 
 };
 
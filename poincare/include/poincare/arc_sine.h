@@ -27,6 +27,7 @@ private:
   int serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
   // Simplification
   Expression shallowReduce(ReductionContext reductionContext) override;
+  Expression unaryFunctionDifferential(ReductionContext reductionContext) const override;
   LayoutShape leftLayoutShape() const override { return LayoutShape::MoreLetters; };
   LayoutShape rightLayoutShape() const override { return LayoutShape::BoundaryPunctuation; }
 
@@ -48,6 +49,7 @@ public:
   static constexpr Expression::FunctionHelper s_functionHelper = Expression::FunctionHelper("asin", 1, &UntypedBuilderOneChild<ArcSine>);
 
   Expression shallowReduce(ExpressionNode::ReductionContext reductionContext);
+  Expression unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const;
 };
 
 }
@@ -20,6 +20,11 @@ public:
    * Integer on the static Integer table that limit the number of Integer
    * simultaneously alive. */
   static int PrimeFactorization(const Integer & i, Integer outputFactors[], Integer outputCoefficients[], int outputLength);
+  /* Exact combinatorics on non-negative integers. They return an overflow
+   * Integer when the result is too large to be represented. */
+  static Integer Factorial(const Integer & n);
+  static Integer BinomialCoefficient(const Integer & n, const Integer & k);
+  static Integer PermuteCoefficient(const Integer & n, const Integer & k);
   constexpr static int k_numberOfPrimeFactors = 1000;
   constexpr static int k_maxNumberOfPrimeFactors = 32;
 private:
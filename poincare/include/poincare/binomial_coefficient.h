@@ -43,8 +43,6 @@ public:
 
   // Expression
   Expression shallowReduce(Context * context);
-private:
-  constexpr static int k_maxNValue = 300;
 };
 
 }
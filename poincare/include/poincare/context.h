@@ -1,6 +1,7 @@
 #ifndef POINCARE_CONTEXT_H
 #define POINCARE_CONTEXT_H
 
+#include <poincare/preferences.h>
 #include <stdint.h>
 #include <assert.h>
 
@@ -8,6 +9,7 @@ namespace Poincare {
 
 class Expression;
 class SymbolAbstract;
+class Symbol;
 
 class Context {
 public:
@@ -19,6 +21,10 @@ public:
   virtual SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) = 0;
   virtual const Expression expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone) = 0;
   virtual void setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) = 0;
+  /* Some contexts can provide the real approximation of a symbol without
+   * expanding its definition, because they memoize it. Return false if the
+   * approximation has to be computed from the expression of the symbol. */
+  virtual bool approximationForSymbol(const Symbol & symbol, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool doublePrecision, double * value) { return false; }
 };
 
 }
@@ -15,6 +15,10 @@ public:
   SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) override { return m_parentContext->expressionTypeForIdentifier(identifier, length); }
   void setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) override { m_parentContext->setExpressionForSymbolAbstract(expression, symbol); }
   const Expression expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone) override { return m_parentContext->expressionForSymbolAbstract(symbol, clone); }
+protected:
+  /* approximationForSymbol is not forwarded to the parent context by default:
+   * the parent could memoize a symbol that this context defines differently. */
+  Context * parentContext() const { return m_parentContext; }
 private:
   Context * m_parentContext;
 };
@@ -53,7 +53,9 @@ public:
   static Expression UntypedBuilder(Expression children);
   static constexpr Expression::FunctionHelper s_functionHelper = Expression::FunctionHelper("diff", 3, &UntypedBuilder);
 
-  Expression shallowReduce(Context * context);
+  Expression shallowReduce(ExpressionNode::ReductionContext reductionContext);
+  // Replace f(g) with f'(g)×g', returns false if f has no derivation rule
+  static bool DerivateUnaryFunction(Expression function, const Symbol & symbol, ExpressionNode::ReductionContext reductionContext);
 };
 
 }
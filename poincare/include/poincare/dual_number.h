@@ -0,0 +1,57 @@
+#ifndef POINCARE_DUAL_NUMBER_H
+#define POINCARE_DUAL_NUMBER_H
+
+#include <cmath>
+
+namespace Poincare {
+
+/* A DualNumber holds the real value of a function of one variable at a point
+ * and its first two derivatives there, i.e. its Taylor expansion to the
+ * second order. It is computed with forward-mode automatic differentiation:
+ * each node applies the chain rule to the dual numbers of its children, so
+ * that one walk of the tree yields f(x), f'(x) and f''(x).
+ * A dual number is undefined when the function is not defined or not twice
+ * differentiable at the point, or when a node does not provide derivatives.
+ * All its components are then NAN. */
+
+class DualNumber {
+public:
+  DualNumber(double value, double derivative = 0.0, double secondDerivative = 0.0);
+  static DualNumber Constant(double x) { return DualNumber(x); }
+  static DualNumber Variable(double x) { return DualNumber(x, 1.0); }
+  static DualNumber Undefined() { return DualNumber(NAN, NAN, NAN); }
+
+  double value() const { return m_value; }
+  double derivative() const { return m_derivative; }
+  double secondDerivative() const { return m_secondDerivative; }
+  bool isUndefined() const { return std::isnan(m_value); }
+  bool isConstant() const { return m_derivative == 0.0 && m_secondDerivative == 0.0; }
+
+  // Arithmetic
+  static DualNumber Add(DualNumber a, DualNumber b);
+  static DualNumber Multiply(DualNumber a, DualNumber b);
+  static DualNumber Inverse(DualNumber a);
+  static DualNumber Power(DualNumber base, DualNumber exponent);
+  static DualNumber Scale(DualNumber a, double factor) { return DualNumber(factor * a.m_value, factor * a.m_derivative, factor * a.m_secondDerivative); }
+
+  // Elementary functions, angles are in radians
+  static DualNumber Exponential(DualNumber a);
+  static DualNumber Logarithm(DualNumber a);
+  static DualNumber SquareRoot(DualNumber a);
+  static DualNumber AbsoluteValue(DualNumber a);
+  static DualNumber Sine(DualNumber a);
+  static DualNumber Cosine(DualNumber a);
+  static DualNumber Tangent(DualNumber a);
+  static DualNumber ArcTangent(DualNumber a);
+
+private:
+  // Chain rule for f(a), given f, f' and f'' at the value of a
+  static DualNumber Compose(DualNumber a, double f, double df, double d2f);
+  double m_value;
+  double m_derivative;
+  double m_secondDerivative;
+};
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef POINCARE_ENCLOSURE_H
+#define POINCARE_ENCLOSURE_H
+
+#include <math.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* An Enclosure bounds the real values taken by a function of one variable
+ * when the variable spans an interval. It is computed with interval
+ * arithmetic: each node combines the enclosures of its children.
+ * The decoration tells what is known about the function on the whole
+ * interval:
+ * - Continuous: the function is defined and continuous on the interval, and
+ *   its values lie in [lower, upper].
+ * - Discontinuous: the function may jump or diverge on the interval (floor
+ *   crossing an integer, division by an interval containing 0...).
+ * - Unknown: nothing could be proven, for instance because a node does not
+ *   provide an enclosure or because the function is only partially defined.
+ * Bounds are not rounded outwards: they are only accurate up to double
+ * precision, which is far below what is needed to plot a curve. */
+
+class Enclosure {
+public:
+  enum class Decoration : uint8_t {
+    Continuous,
+    Unknown,
+    Discontinuous
+  };
+  Enclosure(double lower, double upper, Decoration decoration = Decoration::Continuous);
+  static Enclosure Point(double x);
+  static Enclosure Unknown() { return Enclosure(-INFINITY, INFINITY, Decoration::Unknown); }
+  static Enclosure Discontinuous() { return Enclosure(-INFINITY, INFINITY, Decoration::Discontinuous); }
+
+  double lower() const { return m_lower; }
+  double upper() const { return m_upper; }
+  Decoration decoration() const { return m_decoration; }
+  bool isContinuous() const { return m_decoration == Decoration::Continuous; }
+  bool isDiscontinuous() const { return m_decoration == Decoration::Discontinuous; }
+  bool isPoint() const { return isContinuous() && m_lower == m_upper; }
+  bool contains(double x) const { return m_lower <= x && x <= m_upper; }
+
+  // Arithmetic
+  static Enclosure Add(Enclosure a, Enclosure b);
+  static Enclosure Multiply(Enclosure a, Enclosure b);
+  static Enclosure Inverse(Enclosure a);
+  static Enclosure Power(Enclosure base, Enclosure exponent);
+  static Enclosure IntegerPower(Enclosure base, int n);
+
+  // Elementary functions, angles are in radians
+  static Enclosure Exponential(Enclosure a);
+  static Enclosure Logarithm(Enclosure a);
+  static Enclosure SquareRoot(Enclosure a);
+  static Enclosure AbsoluteValue(Enclosure a);
+  static Enclosure Sine(Enclosure a);
+  static Enclosure Cosine(Enclosure a);
+  static Enclosure ArcTangent(Enclosure a);
+  static Enclosure Floor(Enclosure a);
+  static Enclosure Ceiling(Enclosure a);
+  static Enclosure FracPart(Enclosure a);
+  static Enclosure Scale(Enclosure a, double factor) { return Multiply(a, Point(factor)); }
+
+private:
+  static Decoration WorstDecoration(Decoration d1, Decoration d2) { return d1 > d2 ? d1 : d2; }
+  // Builds the enclosure of a monotonic function from its values at the bounds
+  static Enclosure Monotonic(Enclosure a, double f1, double f2);
+  double m_lower;
+  double m_upper;
+  Decoration m_decoration;
+};
+
+}
+
+#endif
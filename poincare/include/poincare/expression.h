@@ -82,6 +82,7 @@ class Expression : public TreeHandle {
   friend class Product;
   friend class Randint;
   friend class RealPart;
+  friend class ReductionMemo;
   friend class Round;
   friend class Sequence;
   friend class SignFunction;
@@ -171,6 +172,18 @@ public:
    * NB: so far, we consider that the only way of building a periodic function
    * is to use sin/tan/cos(f(x)) with f a linear function. */
   float characteristicXRange(Context * context, Preferences::AngleUnit angleUnit) const { return node()->characteristicXRange(context, angleUnit); }
+  /* 'enclosure' bounds the real values of the expression (considered as a
+   * function on x) when x spans the interval x. It should be called on
+   * reduced expressions where x has been replaced by UCodePointUnknown. Nodes
+   * that do not know how to combine the enclosures of their children return
+   * an Unknown enclosure unless they are x-independent. */
+  Enclosure enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const { return node()->enclosure(x, context, complexFormat, angleUnit); }
+  /* 'dualNumber' returns the real value of the expression and its first two
+   * derivatives with respect to x, at the value of the dual number x. Like
+   * enclosure, it expects x to be UCodePointUnknown. Nodes that do not know
+   * how to derive return an undefined dual number unless they are
+   * x-independent. */
+  DualNumber dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const { return node()->dualNumber(x, context, complexFormat, angleUnit); }
   /* polynomialDegree returns:
    * - (-1) if the expression is not a polynome
    * - the degree of the polynome otherwise */
@@ -190,10 +203,11 @@ public:
    * order) and 'constant' with the constant of the expression. */
   bool getLinearCoefficients(char * variables, int maxVariableLength, Expression coefficients[], Expression constant[], Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, ExpressionNode::SymbolicComputation symbolicComputation) const;
   /* getPolynomialCoefficients fills the table coefficients with the expressions
-   * of the first 3 polynomial coefficients and returns the  polynomial degree.
+   * of the polynomial coefficients and returns the polynomial degree, or -1 if
+   * the degree exceeds k_maxPolynomialDegree.
    * It is supposed to be called on a reduced expression.
-   * coefficients has up to 3 entries.  */
-  static constexpr int k_maxPolynomialDegree = 2;
+   * coefficients has up to k_maxNumberOfPolynomialCoefficients entries. */
+  static constexpr int k_maxPolynomialDegree = 10;
   static constexpr int k_maxNumberOfPolynomialCoefficients = k_maxPolynomialDegree+1;
   int getPolynomialReducedCoefficients(const char * symbolName, Expression coefficients[], Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, ExpressionNode::SymbolicComputation symbolicComputation) const;
   Expression replaceSymbolWithExpression(const SymbolAbstract & symbol, const Expression & expression) { return node()->replaceSymbolWithExpression(symbol, expression); }
@@ -261,6 +275,12 @@ public:
   template<typename U> U approximateToScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   template<typename U> static U ApproximateToScalar(const char * text, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, ExpressionNode::SymbolicComputation symbolicComputation = ExpressionNode::SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition);
   template<typename U> U approximateWithValueForSymbol(const char * symbol, U x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  /* approximateKeepingSymbols replaces the subtrees without symbols nor random
+   * nodes by their approximation when it is real, so that the expression can
+   * be approximated for many values of its symbols without approximating them
+   * again. Leaves are kept: some nodes, like Power, look for Rational
+   * children. */
+  Expression approximateKeepingSymbols(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
   /* Expression roots/extrema solver */
   Coordinate2D<double> nextMinimum(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   Coordinate2D<double> nextMaximum(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
@@ -276,7 +296,7 @@ public:
       m_name(name),
       m_numberOfChildren(numberOfChildren),
       m_untypedBuilder(builder) {}
-    const char * name() const { return m_name; }
+    constexpr const char * name() const { return m_name; }
     int numberOfChildren() const { return m_numberOfChildren; }
     Expression build(Expression children) const { return (*m_untypedBuilder)(children); }
   private:
@@ -379,6 +399,9 @@ protected:
   Expression deepBeautify(ExpressionNode::ReductionContext reductionContext);
   // WARNING: this must be called on reduced expressions
   Expression setSign(ExpressionNode::Sign s, ExpressionNode::ReductionContext reductionContext);
+  // WARNING: this must be called on reduced expressions
+  bool derivate(ExpressionNode::ReductionContext reductionContext, const Symbol & symbol) { return node()->didDerivate(reductionContext, symbol); }
+  Expression unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const { return node()->unaryFunctionDifferential(reductionContext); }
 
 private:
   static constexpr int k_maxSymbolReplacementsCount = 10;
@@ -423,9 +446,11 @@ private:
   /* Expression roots/extrema solver*/
   constexpr static double k_solverPrecision = 1.0E-5;
   constexpr static double k_maxFloat = 1e100;
-  Coordinate2D<double> nextMinimumOfExpression(const char * symbol, double start, double step, double max, Solver::ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression = Expression(), bool lookForRootMinimum = false) const;
+  Coordinate2D<double> nextMinimumOfExpression(const char * symbol, double start, double step, double max, Solver::ValueAtAbscissa evaluation, Solver::DualNumberAtAbscissa dualEvaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression = Expression(), bool lookForRootMinimum = false) const;
   void bracketMinimum(const char * symbol, double start, double step, double max, double result[3], Solver::ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression = Expression()) const;
-  double nextIntersectionWithExpression(const char * symbol, double start, double step, double max, Solver::ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression) const;
+  double nextIntersectionWithExpression(const char * symbol, double start, double step, double max, Solver::ValueAtAbscissa evaluation, Solver::DualNumberAtAbscissa dualEvaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression) const;
+  // Clone where symbol is replaced with UCodePointUnknown, as dualNumber expects
+  Expression cloneWithUnknownSymbol(const char * symbol) const;
   void bracketRoot(const char * symbol, double start, double step, double max, double result[2], Solver::ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression) const;
 };
 
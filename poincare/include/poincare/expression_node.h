@@ -2,6 +2,8 @@
 #define POINCARE_EXPRESSION_NODE_H
 
 #include <poincare/tree_node.h>
+#include <poincare/dual_number.h>
+#include <poincare/enclosure.h>
 #include <poincare/evaluation.h>
 #include <poincare/layout.h>
 #include <poincare/context.h>
@@ -13,6 +15,7 @@ namespace Poincare {
  * 'this' outdated. They should only be called in a wrapper on Expression. */
 
 class SymbolAbstract;
+class ReductionMemo;
 class Symbol;
 class ComplexCartesian;
 
@@ -150,7 +153,8 @@ public:
       m_angleUnit(angleUnit),
       m_target(target),
       m_symbolicComputation(symbolicComputation),
-      m_unitConversion(unitConversion)
+      m_unitConversion(unitConversion),
+      m_memo(nullptr)
     {}
     Context * context() { return m_context; }
     Preferences::ComplexFormat complexFormat() const { return m_complexFormat; }
@@ -158,6 +162,8 @@ public:
     ReductionTarget target() const { return m_target; }
     SymbolicComputation symbolicComputation() const { return m_symbolicComputation; }
     UnitConversion unitConversion() const { return m_unitConversion; }
+    ReductionMemo * memo() const { return m_memo; }
+    void setMemo(ReductionMemo * memo) { m_memo = memo; }
   private:
     Context * m_context;
     Preferences::ComplexFormat m_complexFormat;
@@ -165,6 +171,7 @@ public:
     ReductionTarget m_target;
     SymbolicComputation m_symbolicComputation;
     UnitConversion m_unitConversion;
+    ReductionMemo * m_memo;
   };
 
   virtual Sign sign(Context * context) const { return Sign::Unknown; }
@@ -184,6 +191,8 @@ public:
   typedef bool (*isVariableTest)(const char * c, Poincare::Context * context);
   virtual int getVariables(Context * context, isVariableTest isVariable, char * variables, int maxSizeVariable, int nextVariableIndex) const;
   virtual float characteristicXRange(Context * context, Preferences::AngleUnit angleUnit) const;
+  virtual Enclosure enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  virtual DualNumber dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   bool isOfType(Type * types, int length) const;
 
   virtual Expression removeUnit(Expression * unit); // Only reduced nodes should answer
@@ -225,6 +234,14 @@ public:
   /*!*/ virtual Expression shallowBeautify(ReductionContext reductionContext);
   /* Return a clone of the denominator part of the expression */
   /*!*/ virtual Expression denominator(ExpressionNode::ReductionContext reductionContext) const;
+  /* didDerivate replaces the reduced expression with its derivative with
+   * respect to symbol. The derivatives of the children are left as Derivative
+   * nodes evaluated at symbol, which are reduced in turn. It returns false,
+   * leaving the expression untouched, if no derivation rule applies. */
+  /*!*/ virtual bool didDerivate(ReductionContext reductionContext, const Symbol & symbol);
+  /* unaryFunctionDifferential returns f'(x) for a function f of one child x,
+   * or an uninitialized expression if f has no derivation rule. */
+  virtual Expression unaryFunctionDifferential(ReductionContext reductionContext) const;
   /* LayoutShape is used to check if the multiplication sign can be omitted between two expressions. It depends on the "layout syle" of the on the right of the left expression */
   enum class LayoutShape {
     Decimal,
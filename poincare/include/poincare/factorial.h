@@ -55,8 +55,6 @@ public:
   static Factorial Builder(Expression child) { return TreeHandle::FixedArityBuilder<Factorial, FactorialNode>({child}); }
 
   Expression shallowReduce(ExpressionNode::ReductionContext reductionContext);
-private:
-  constexpr static int k_maxOperandValue = 100;
 };
 
 }
@@ -21,6 +21,7 @@ public:
   Type type() const override { return Type::HyperbolicCosine; }
 private:
   // Simplification
+  Expression unaryFunctionDifferential(ReductionContext reductionContext) const override;
   Expression imageOfNotableValue() const override { return Rational::Builder(1); }
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
@@ -41,6 +42,8 @@ public:
   static HyperbolicCosine Builder(Expression child) { return TreeHandle::FixedArityBuilder<HyperbolicCosine, HyperbolicCosineNode>({child}); }
 
   static constexpr Expression::FunctionHelper s_functionHelper = Expression::FunctionHelper("cosh", 1, &UntypedBuilderOneChild<HyperbolicCosine>);
+
+  Expression unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const;
 };
 
 }
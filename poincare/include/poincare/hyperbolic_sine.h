@@ -20,6 +20,8 @@ public:
   // Properties
   Type type() const override { return Type::HyperbolicSine; }
 private:
+  // Simplification
+  Expression unaryFunctionDifferential(ReductionContext reductionContext) const override;
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
   int serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
@@ -39,6 +41,8 @@ public:
   static HyperbolicSine Builder(Expression child) { return TreeHandle::FixedArityBuilder<HyperbolicSine, HyperbolicSineNode>({child}); }
 
   static constexpr Expression::FunctionHelper s_functionHelper = Expression::FunctionHelper("sinh", 1, &UntypedBuilderOneChild<HyperbolicSine>);
+
+  Expression unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const;
 };
 
 }
@@ -49,7 +49,7 @@ public:
   Infinity(InfinityNode * n) : Number(n) {}
   static Infinity Builder(bool negative);
   Expression setSign(ExpressionNode::Sign s);
-  static const char * Name() {
+  static constexpr const char * Name() {
     return "inf";
   }
   static int NameSize() {
@@ -153,7 +153,6 @@ public:
   static Integer Multiplication(const Integer & i, const Integer & j) { return multiplication(i, j); }
   static IntegerDivision Division(const Integer & numerator, const Integer & denominator);
   static Integer Power(const Integer & i, const Integer & j);
-  static Integer Factorial(const Integer & i);
 
   // Derived expression builder
   static Expression CreateMixedFraction(const Integer & num, const Integer & denom);
@@ -83,8 +83,9 @@ public:
    * not. */
   Expression createInverse(ExpressionNode::ReductionContext reductionContext, bool * couldComputeInverse) const;
   Expression determinant(ExpressionNode::ReductionContext reductionContext, bool * couldComputeDeterminant, bool inPlace);
-  // TODO: find another solution for inverse and determinant (avoid capping the matrix)
-  static constexpr int k_maxNumberOfCoefficients = 100;
+  /* Approximated inverse, determinant and power copy the coefficients in
+   * stack arrays, which caps the size of the matrix to 20x20. */
+  static constexpr int k_maxNumberOfCoefficients = 400;
 
   // Expression
   Expression shallowReduce(Context * context);
@@ -96,9 +97,6 @@ private:
   Expression computeInverseOrDeterminant(bool computeDeterminant, ExpressionNode::ReductionContext reductionContext, bool * couldCompute) const;
   // rowCanonize turns a matrix in its reduced row echelon form.
   Matrix rowCanonize(ExpressionNode::ReductionContext reductionContext, Expression * determinant);
-  // Row canonize the array in place
-  template<typename T> static void ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * c = nullptr);
-
 };
 
 }
@@ -0,0 +1,38 @@
+#ifndef POINCARE_MATRIX_ARRAY_H
+#define POINCARE_MATRIX_ARRAY_H
+
+#include <stdint.h>
+
+namespace Poincare {
+
+/* Dense linear algebra on row-major arrays of T, where T is float, double or
+ * std::complex of those. These routines do not allocate: the caller provides
+ * the buffers, which are usually on the stack and bounded by
+ * Matrix::k_maxNumberOfCoefficients. */
+
+namespace MatrixArray {
+  /* Call action on a stack buffer of at least numberOfCoefficients T, at most
+   * Matrix::k_maxNumberOfCoefficients. The buffer is sized to the smallest of
+   * a few capacities, and lives in a frame of its own: callers do not hold it
+   * across their recursive calls. */
+  template<typename R, typename T> R WithBuffer(int numberOfCoefficients, R (*action)(T * buffer, const void * context1, const void * context2), const void * context1, const void * context2 = nullptr);
+  // result = a*b, result has to be distinct from a and b
+  template<typename T> void Multiply(const T * a, const T * b, T * result, int numberOfRows, int numberOfInnerCoefficients, int numberOfColumns);
+  /* result = base^exponent by squaring. base and scratch are overwritten. The
+   * three dim*dim buffers have to be distinct. Returns false if the
+   * computation was interrupted. */
+  template<typename T> bool Power(T * base, T * result, T * scratch, int dim, uint32_t exponent);
+  /* Replace array with its LU decomposition with partial pivoting: the
+   * multipliers of L are stored under the diagonal, U on and above it. Row k
+   * was swapped with row pivots[k] at step k. Returns the sign of the row
+   * permutation, or 0 if the matrix is singular. */
+  template<typename T> int LUDecompose(T * array, int dim, int * pivots);
+  // The array is overwritten with its LU decomposition
+  template<typename T> T Determinant(T * array, int dim);
+  // Inverse the array in-place. Returns false if the matrix is singular.
+  template<typename T> bool Inverse(T * array, int dim);
+}
+
+}
+
+#endif
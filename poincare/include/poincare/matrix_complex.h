@@ -46,6 +46,9 @@ public:
   std::complex<T> determinant() const override;
   MatrixComplex<T> inverse() const;
   MatrixComplex<T> transpose() const;
+  /* Copy the coefficients in a row-major array. Returns false if some of them
+   * are not complexes, which are then copied as NAN. */
+  bool copyOperands(std::complex<T> * operands) const;
 private:
   // See comment on Matrix
   uint16_t m_numberOfRows;
@@ -66,6 +69,7 @@ public:
   std::complex<T> complexAtIndex(int index) const {
     return node()->complexAtIndex(index);
   }
+  bool copyOperands(std::complex<T> * operands) const { return node()->copyOperands(operands); }
   int numberOfRows() const { return node()->numberOfRows(); }
   int numberOfColumns() const { return node()->numberOfColumns(); }
   void setDimensions(int rows, int columns);
@@ -46,8 +46,6 @@ public:
 
   // Expression
   Expression shallowReduce(Context * context);
-
-  constexpr static int k_maxNValue = 100;
 };
 
 }
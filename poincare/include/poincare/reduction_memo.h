@@ -0,0 +1,63 @@
+#ifndef POINCARE_REDUCTION_MEMO_H
+#define POINCARE_REDUCTION_MEMO_H
+
+#include <poincare/expression.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* A ReductionMemo remembers the reduced forms of the last small subtrees
+ * reduced by Expression::reduce, so that identical subtrees, such as a sin(x)
+ * repeated in a long sum or identical matrix entries, are only reduced once.
+ * Subtrees are looked up by their structural hash, and a matching entry is
+ * confirmed with isIdenticalTo.
+ * Besides its own nodes, the reduction of a subtree depends on the type of its
+ * parent, which is part of the key. Subtrees whose reduction depends on more
+ * than that (random nodes, parameters of a parametered expression...) are not
+ * memoized.
+ * The memo lives on the stack of Expression::reduce and is handed down through
+ * the ReductionContext, so that no entry outlives a pool exception. */
+
+class ReductionMemo {
+public:
+  ReductionMemo() : m_numberOfEntries(0), m_nextEntry(0) {}
+  class Key {
+    friend class ReductionMemo;
+  public:
+    Key() : m_hash(0), m_parentType(ExpressionNode::Type::Uninitialized), m_isValid(false) {}
+    bool isValid() const { return m_isValid; }
+  private:
+    uint32_t m_hash;
+    ExpressionNode::Type m_parentType;
+    bool m_isValid;
+  };
+  /* Return a clone of the memoized reduced form of e, or an uninitialized
+   * expression. key is set to the key of e, which is invalid if e should not
+   * be memoized. */
+  Expression reducedExpression(const Expression e, Key * key) const;
+  // expression has to be a clone of the unreduced expression
+  void storeReducedExpression(Key key, Expression expression, const Expression reducedExpression);
+  /* Structural hash of a subtree: identical subtrees have the same hash. It is
+   * computed on at most k_maxNumberOfNodes nodes and returns false if the
+   * subtree is bigger or cannot be memoized. */
+  static bool Hash(const Expression e, uint32_t * hash);
+private:
+  constexpr static int k_numberOfEntries = 4;
+  constexpr static int k_maxNumberOfNodes = 16;
+  /* The memoized expressions are kept in the pool: no subtree is memoized once
+   * the pool is half-full, not to make the reduction run out of memory. */
+  constexpr static int k_maxPoolSize = TreePool::BufferSize / 2;
+  static bool HashSubtree(const Expression e, uint32_t * hash, int * numberOfNodes);
+  struct Entry {
+    Key key;
+    Expression expression;
+    Expression reducedExpression;
+  };
+  Entry m_entries[k_numberOfEntries];
+  int m_numberOfEntries;
+  int m_nextEntry;
+};
+
+}
+
+#endif
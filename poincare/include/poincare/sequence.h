@@ -4,6 +4,7 @@
 #include <poincare/parametered_expression.h>
 #include <poincare/symbol.h>
 #include <poincare/approximation_helper.h>
+#include <complex>
 
 namespace Poincare {
 
@@ -22,6 +23,14 @@ private:
   Evaluation<float> approximate(SinglePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override { return templatedApproximate<float>(context, complexFormat, angleUnit); }
   Evaluation<double> approximate(DoublePrecision p, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const override { return templatedApproximate<double>(context, complexFormat, angleUnit); }
  template<typename T> Evaluation<T> templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  /* Sequences up to infinity are approximated by accelerating the convergence
+   * of their partial results with Levin's u-transform. The limit is undefined
+   * if the transform does not converge using k_maxNumberOfAcceleratedTerms
+   * terms, or if the terms do not decrease. */
+  constexpr static int k_maxNumberOfAcceleratedTerms = 30;
+  constexpr static double k_seriesRelativeTolerance = 1E-9;
+  constexpr static double k_maxRemainderToTermRatio = 10.0;
+  std::complex<double> approximateSeries(double start, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   virtual float emptySequenceValue() const = 0;
   virtual Evaluation<float> evaluateWithNextTerm(SinglePrecision p, Evaluation<float> a, Evaluation<float> b, Preferences::ComplexFormat complexFormat) const = 0;
   virtual Evaluation<double> evaluateWithNextTerm(DoublePrecision p, Evaluation<double> a, Evaluation<double> b, Preferences::ComplexFormat complexFormat) const = 0;
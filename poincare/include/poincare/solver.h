@@ -3,7 +3,9 @@
 
 #include <poincare/context.h>
 #include <poincare/coordinate_2D.h>
+#include <poincare/dual_number.h>
 #include <poincare/preferences.h>
+#include <complex>
 
 namespace Poincare {
 
@@ -12,11 +14,31 @@ public:
   // Minimum
   typedef double (*ValueAtAbscissa)(double abscissa, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3);
   static Coordinate2D<double> BrentMinimum(double ax, double bx, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
+  /* Safeguarded Newton's method on the derivative, with derivatives computed
+   * by the evaluation. It requires the derivative to be defined and to change
+   * sign on [ax, bx], and returns (NAN, NAN) otherwise, in which case
+   * BrentMinimum should be used instead. */
+  typedef DualNumber (*DualNumberAtAbscissa)(double abscissa, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3);
+  static Coordinate2D<double> NewtonMinimum(double ax, double bx, DualNumberAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
 
   // Root
   static double BrentRoot(double ax, double bx, double precision, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
+  /* Newton's method, falling back to bisection whenever a step leaves the
+   * bracket or does not shrink fast enough. Returns NAN if the function is not
+   * differentiable on [ax, bx] or does not change sign, in which case
+   * BrentRoot should be used instead. */
+  static double NewtonRoot(double ax, double bx, double precision, DualNumberAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
   static Coordinate2D<double> IncreasingFunctionRoot(double ax, double bx, double resultPrecision, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr, double * resultEvaluation = nullptr);
 
+  // Polynomial
+  /* Find all the complex roots of the polynomial of the given degree whose
+   * coefficient of x^k is coefficients[k], with the Aberth-Ehrlich iteration.
+   * The distinct roots are written in roots, sorted by real and imaginary
+   * parts, and their number is returned. Returns -1 if the coefficients are
+   * not finite or the iteration does not converge. */
+  static int PolynomialRoots(const std::complex<double> * coefficients, int degree, std::complex<double> * roots);
+  constexpr static int k_maxPolynomialRootsDegree = 10;
+
   // Proba
 
   // Cumulative distributive inverse for function defined on N (positive integers)
@@ -26,7 +48,18 @@ public:
   template<typename T> static T CumulativeDistributiveFunctionForNDefinedFunction(T x, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
 
 private:
+  /* Find a zero of the value (order 0) or of the derivative (order 1) of the
+   * function between low, where it is negative, and high. Returns the zero
+   * and the value of the function there. */
+  static Coordinate2D<double> SafeguardedNewton(double low, double high, double precision, int order, DualNumberAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3);
+  /* Value of the polynomial and of its derivative at z. bound is the value of
+   * the polynomial with the moduli of z and of the coefficients, which bounds
+   * the rounding error of the evaluation once multiplied by DBL_EPSILON. */
+  static std::complex<double> PolynomialValue(const std::complex<double> * coefficients, int degree, std::complex<double> z, std::complex<double> * derivative, double * bound);
   constexpr static int k_maxNumberOfOperations = 1000000;
+  constexpr static int k_maxNumberOfNewtonSteps = 60;
+  constexpr static int k_maxNumberOfAberthSteps = 100;
+  constexpr static int k_numberOfPolishingSteps = 2;
   constexpr static double k_maxProbability = 0.9999995;
   constexpr static double k_sqrtEps = 1.4901161193847656E-8; // sqrt(DBL_EPSILON)
   constexpr static double k_goldenRatio = 0.381966011250105151795413165634361882279690820194237137864; // (3-sqrt(5))/2
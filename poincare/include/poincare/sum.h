@@ -2,6 +2,7 @@
 #define POINCARE_SUM_H
 
 #include <poincare/sequence.h>
+#include <poincare/integer.h>
 
 namespace Poincare {
 
@@ -18,6 +19,8 @@ public:
   Type type() const override { return Type::Sum; }
 
 private:
+  // Simplification
+  Expression shallowReduce(ReductionContext reductionContext) override;
   float emptySequenceValue() const override { return 0.0f; }
   Layout createSequenceLayout(Layout argumentLayout, Layout symbolLayout, Layout subscriptLayout, Layout superscriptLayout) const override;
   int serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
@@ -38,6 +41,17 @@ public:
   static Expression UntypedBuilder(Expression children);
 
   static constexpr Expression::FunctionHelper s_functionHelper = Expression::FunctionHelper("sum", 4, &UntypedBuilder);
+
+  Expression shallowReduce(ExpressionNode::ReductionContext reductionContext);
+private:
+  /* Sums of polynomial or geometric terms between integer bounds are replaced
+   * with their closed form. Polynomials of higher degree are left to the
+   * approximation, as the closed form needs degree+1 evaluations of the
+   * term. */
+  constexpr static int k_maxPolynomialClosedFormDegree = 10;
+  Expression polynomialClosedForm(const Integer & lowerBound, const Integer & numberOfTerms, int degree, ExpressionNode::ReductionContext reductionContext);
+  Expression geometricClosedForm(const Integer & lowerBound, const Integer * numberOfTerms, ExpressionNode::ReductionContext reductionContext);
+  Expression termAt(const Integer & index) const;
 };
 
 }
@@ -18,11 +18,12 @@ class TreePool final {
   friend class TreeNode;
   friend class TreeHandle;
   friend class ExceptionCheckpoint;
+  friend class ReductionMemo;
 public:
   static TreePool * sharedPool() { assert(SharedStaticPool != nullptr); return SharedStaticPool; }
   static void RegisterPool(TreePool * pool) {  assert(SharedStaticPool == nullptr); SharedStaticPool = pool; }
 
-  TreePool() : m_cursor(buffer()) {}
+  TreePool() : m_cursor(buffer()), m_peakSize(0) {}
 
   // Node
   TreeNode * node(uint16_t identifier) const {
@@ -49,6 +50,11 @@ public:
   __attribute__((__used__)) void log() { treeLog(std::cout); }
 #endif
   int numberOfNodes() const;
+  size_t size() const { return m_cursor - constBuffer(); }
+  /* The peak size is the high-water mark of the pool since the last call to
+   * resetPeakSize. It is used by the test runner to track memory usage. */
+  size_t peakSize() const { return m_peakSize; }
+  void resetPeakSize() { m_peakSize = size(); }
 
 private:
   constexpr static int BufferSize = 16384;
@@ -147,6 +153,7 @@ private:
   const char * constBuffer() const { return reinterpret_cast<const char *>(m_alignedBuffer); }
   AlignedNodeBuffer m_alignedBuffer[BufferSize/ByteAlignment];
   char * m_cursor;
+  size_t m_peakSize;
   IdentifierStack m_identifiers;
   uint16_t m_nodeForIdentifierOffset[MaxNumberOfNodes];
   static_assert(k_maxNodeOffset < UINT16_MAX && sizeof(m_nodeForIdentifierOffset[0]) == sizeof(uint16_t),
@@ -13,6 +13,8 @@ public:
     Sine = 1,
   };
   static double PiInAngleUnit(Preferences::AngleUnit angleUnit);
+  // Factor converting an angle in fromUnit into toUnit
+  static Expression UnitConversionFactor(Preferences::AngleUnit fromUnit, Preferences::AngleUnit toUnit);
   static float characteristicXRange(const Expression & e, Context * context, Preferences::AngleUnit angleUnit);
   static bool isDirectTrigonometryFunction(const Expression & e);
   static bool isInverseTrigonometryFunction(const Expression & e);
@@ -41,7 +41,7 @@ class Unreal final : public Number {
 public:
   static Unreal Builder() { return TreeHandle::FixedArityBuilder<Unreal, UnrealNode>(); }
   Unreal() = delete;
-  static const char * Name() {
+  static constexpr const char * Name() {
     return "unreal";
   }
   static int NameSize() {
@@ -19,6 +19,7 @@ public:
   // Context
   void setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) override;
   const Expression expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone) override;
+  bool approximationForSymbol(const Symbol & symbol, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool doublePrecision, double * value) override;
 
 private:
   const char * m_name;
@@ -19,6 +19,14 @@ Expression AbsoluteValueNode::setSign(Sign s, ReductionContext reductionContext)
   return AbsoluteValue(this);
 }
 
+Enclosure AbsoluteValueNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::AbsoluteValue(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit));
+}
+
+DualNumber AbsoluteValueNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::AbsoluteValue(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit));
+}
+
 Layout AbsoluteValueNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return AbsoluteValueLayout::Builder(childAtIndex(0)->createLayout(floatDisplayMode, numberOfSignificantDigits));
 }
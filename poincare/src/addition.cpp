@@ -1,5 +1,6 @@
 #include <poincare/addition.h>
 #include <poincare/complex_cartesian.h>
+#include <poincare/derivative.h>
 #include <poincare/layout_helper.h>
 #include <poincare/matrix.h>
 #include <poincare/multiplication.h>
@@ -31,6 +32,22 @@ int AdditionNode::getPolynomialCoefficients(Context * context, const char * symb
 
 // Layout
 
+Enclosure AdditionNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  Enclosure result = Enclosure::Point(0.0);
+  for (ExpressionNode * c : children()) {
+    result = Enclosure::Add(result, c->enclosure(x, context, complexFormat, angleUnit));
+  }
+  return result;
+}
+
+DualNumber AdditionNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  DualNumber result = DualNumber::Constant(0.0);
+  for (ExpressionNode * c : children()) {
+    result = DualNumber::Add(result, c->dualNumber(x, context, complexFormat, angleUnit));
+  }
+  return result;
+}
+
 Layout AdditionNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Infix(Addition(this), floatDisplayMode, numberOfSignificantDigits, "+");
 }
@@ -45,6 +62,10 @@ Expression AdditionNode::shallowReduce(ReductionContext reductionContext) {
   return Addition(this).shallowReduce(reductionContext);
 }
 
+bool AdditionNode::didDerivate(ReductionContext reductionContext, const Symbol & symbol) {
+  return Addition(this).derivate(reductionContext, symbol);
+}
+
 Expression AdditionNode::shallowBeautify(ReductionContext reductionContext) {
   return Addition(this).shallowBeautify(reductionContext);
 }
@@ -322,6 +343,15 @@ Expression Addition::shallowReduce(ExpressionNode::ReductionContext reductionCon
   return result;
 }
 
+bool Addition::derivate(ExpressionNode::ReductionContext reductionContext, const Symbol & symbol) {
+  // (f+g)' = f'+g'
+  int n = numberOfChildren();
+  for (int i = 0; i < n; i++) {
+    replaceChildAtIndexInPlace(i, Derivative::Builder(childAtIndex(i).clone(), symbol.clone().convert<Symbol>(), symbol.clone()));
+  }
+  return true;
+}
+
 int Addition::NumberOfNonNumeralFactors(const Expression & e) {
   if (e.type() != ExpressionNode::Type::Multiplication) {
     return 1; // Or (e->type() != Type::Rational);
@@ -1,7 +1,12 @@
 #include <poincare/arc_cosine.h>
+#include <poincare/addition.h>
 #include <poincare/complex.h>
 #include <poincare/layout_helper.h>
+#include <poincare/multiplication.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
 #include <poincare/serialization_helper.h>
+#include <poincare/trigonometry.h>
 
 #include <cmath>
 
@@ -23,6 +28,10 @@ Expression ArcCosineNode::shallowReduce(ReductionContext reductionContext) {
   return ArcCosine(this).shallowReduce(reductionContext);
 }
 
+Expression ArcCosineNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return ArcCosine(this).unaryFunctionDifferential(reductionContext);
+}
+
 template<typename T>
 Complex<T> ArcCosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> result;
@@ -48,7 +57,6 @@ Complex<T> ArcCosineNode::computeOnComplex(const std::complex<T> c, Preferences:
   return Complex<T>::Builder(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
 }
 
-
 Expression ArcCosine::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
   {
     Expression e = Expression::defaultShallowReduce();
@@ -60,4 +68,10 @@ Expression ArcCosine::shallowReduce(ExpressionNode::ReductionContext reductionCo
   return Trigonometry::shallowReduceInverseFunction(*this, reductionContext);
 }
 
+Expression ArcCosine::unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const {
+  // acos'(x) = -1/√(1-x^2), with the result converted from radians
+  Expression oneMinusSquare = Addition::Builder(Rational::Builder(1), Multiplication::Builder(Rational::Builder(-1), Power::Builder(childAtIndex(0).clone(), Rational::Builder(2))));
+  return Multiplication::Builder(Rational::Builder(-1), Trigonometry::UnitConversionFactor(Preferences::AngleUnit::Radian, reductionContext.angleUnit()), Power::Builder(oneMinusSquare, Rational::Builder(-1, 2)));
+}
+
 }
@@ -1,7 +1,12 @@
 #include <poincare/arc_sine.h>
+#include <poincare/addition.h>
 #include <poincare/complex.h>
 #include <poincare/layout_helper.h>
+#include <poincare/multiplication.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
 #include <poincare/serialization_helper.h>
+#include <poincare/trigonometry.h>
 
 #include <cmath>
 
@@ -23,6 +28,10 @@ Expression ArcSineNode::shallowReduce(ReductionContext reductionContext) {
   return ArcSine(this).shallowReduce(reductionContext);
 }
 
+Expression ArcSineNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return ArcSine(this).unaryFunctionDifferential(reductionContext);
+}
+
 template<typename T>
 Complex<T> ArcSineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> result;
@@ -48,7 +57,6 @@ Complex<T> ArcSineNode::computeOnComplex(const std::complex<T> c, Preferences::C
   return Complex<T>::Builder(Trigonometry::ConvertRadianToAngleUnit(result, angleUnit));
 }
 
-
 Expression ArcSine::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
   {
     Expression e = Expression::defaultShallowReduce();
@@ -60,4 +68,10 @@ Expression ArcSine::shallowReduce(ExpressionNode::ReductionContext reductionCont
   return Trigonometry::shallowReduceInverseFunction(*this, reductionContext);
 }
 
+Expression ArcSine::unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const {
+  // asin'(x) = 1/√(1-x^2), with the result converted from radians
+  Expression oneMinusSquare = Addition::Builder(Rational::Builder(1), Multiplication::Builder(Rational::Builder(-1), Power::Builder(childAtIndex(0).clone(), Rational::Builder(2))));
+  return Multiplication::Builder(Trigonometry::UnitConversionFactor(Preferences::AngleUnit::Radian, reductionContext.angleUnit()), Power::Builder(oneMinusSquare, Rational::Builder(-1, 2)));
+}
+
 }
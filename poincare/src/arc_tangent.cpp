@@ -1,7 +1,12 @@
 #include <poincare/arc_tangent.h>
+#include <poincare/addition.h>
 #include <poincare/complex.h>
 #include <poincare/layout_helper.h>
+#include <poincare/multiplication.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
 #include <poincare/serialization_helper.h>
+#include <poincare/trigonometry.h>
 
 #include <cmath>
 
@@ -11,6 +16,14 @@ constexpr Expression::FunctionHelper ArcTangent::s_functionHelper;
 
 int ArcTangentNode::numberOfChildren() const { return ArcTangent::s_functionHelper.numberOfChildren(); }
 
+Enclosure ArcTangentNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Scale(Enclosure::ArcTangent(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit)), Trigonometry::PiInAngleUnit(angleUnit)/M_PI);
+}
+
+DualNumber ArcTangentNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Scale(DualNumber::ArcTangent(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit)), Trigonometry::PiInAngleUnit(angleUnit)/M_PI);
+}
+
 Layout ArcTangentNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Prefix(ArcTangent(this), floatDisplayMode, numberOfSignificantDigits, ArcTangent::s_functionHelper.name());
 }
@@ -48,6 +61,10 @@ Expression ArcTangentNode::shallowReduce(ReductionContext reductionContext) {
   return ArcTangent(this).shallowReduce(reductionContext);
 }
 
+Expression ArcTangentNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return ArcTangent(this).unaryFunctionDifferential(reductionContext);
+}
+
 Expression ArcTangent::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
   {
     Expression e = Expression::defaultShallowReduce();
@@ -59,4 +76,10 @@ Expression ArcTangent::shallowReduce(ExpressionNode::ReductionContext reductionC
   return Trigonometry::shallowReduceInverseFunction(*this, reductionContext);
 }
 
+Expression ArcTangent::unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const {
+  // atan'(x) = 1/(1+x^2), with the result converted from radians
+  Expression onePlusSquare = Addition::Builder(Rational::Builder(1), Power::Builder(childAtIndex(0).clone(), Rational::Builder(2)));
+  return Multiplication::Builder(Trigonometry::UnitConversionFactor(Preferences::AngleUnit::Radian, reductionContext.angleUnit()), Power::Builder(onePlusSquare, Rational::Builder(-1)));
+}
+
 }
@@ -103,4 +103,175 @@ int Arithmetic::PrimeFactorization(const Integer & n, Integer outputFactors[], I
   return t+1;
 }
 
+/* Combinatorics are computed from the prime factorization of their result,
+ * whose exponents are given by Legendre's formula: the exponent of p in n! is
+ * Σ floor(n/p^i). The prime powers are then multiplied along a balanced
+ * product tree, so that the operands of each multiplication have similar
+ * sizes and the large partial products are only built once. This requires
+ * all the primes up to n to be in the table primeFactors. */
+
+static int LargestTabulatedPrime() {
+  return primeFactors[Arithmetic::k_numberOfPrimeFactors-1];
+}
+
+static int NumberOfPrimesUpTo(int n) {
+  int min = 0;
+  int max = Arithmetic::k_numberOfPrimeFactors;
+  while (min < max) {
+    int middle = (min + max) / 2;
+    if (primeFactors[middle] <= n) {
+      min = middle + 1;
+    } else {
+      max = middle;
+    }
+  }
+  return min;
+}
+
+// Exponents of a prime p in the factorization of a result depending on n, k
+typedef int (*PrimeExponent)(int p, int n, int k);
+
+static int SwingExponent(int p, int n, int k) {
+  // n!/(floor(n/2)!)^2, the odd parts of floor(n/p^i) only contribute
+  int exponent = 0;
+  for (int q = n / p; q > 0; q /= p) {
+    exponent += q & 1;
+  }
+  return exponent;
+}
+
+static int BinomialExponent(int p, int n, int k) {
+  // n!/(k!(n-k)!)
+  int exponent = 0;
+  for (int a = n / p, b = k / p, c = (n - k) / p; a > 0; a /= p, b /= p, c /= p) {
+    exponent += a - b - c;
+  }
+  return exponent;
+}
+
+static int PermuteExponent(int p, int n, int k) {
+  // n!/(n-k)!
+  int exponent = 0;
+  for (int a = n / p, c = (n - k) / p; a > 0; a /= p, c /= p) {
+    exponent += a - c;
+  }
+  return exponent;
+}
+
+static Integer IntegerPower(int base, int exponent) {
+  Integer result(1);
+  Integer power(base);
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result = Integer::Multiplication(result, power);
+    }
+    exponent >>= 1;
+    if (exponent > 0) {
+      power = Integer::Multiplication(power, power);
+    }
+  }
+  return result;
+}
+
+// Product of p^exponent(p) for the primes of indexes in [first, last)
+static Integer PrimePowersProduct(int first, int last, PrimeExponent exponent, int n, int k) {
+  if (last - first == 1) {
+    return IntegerPower(primeFactors[first], exponent(primeFactors[first], n, k));
+  }
+  int middle = (first + last) / 2;
+  Integer low = PrimePowersProduct(first, middle, exponent, n, k);
+  if (low.isOverflow()) {
+    return low;
+  }
+  return Integer::Multiplication(low, PrimePowersProduct(middle, last, exponent, n, k));
+}
+
+static Integer PrimePowersProduct(PrimeExponent exponent, int n, int k) {
+  int numberOfPrimes = NumberOfPrimesUpTo(n);
+  return numberOfPrimes == 0 ? Integer(1) : PrimePowersProduct(0, numberOfPrimes, exponent, n, k);
+}
+
+static Integer FactorialOf(int n) {
+  // Prime swing: n! = (floor(n/2)!)^2 × swing(n)
+  if (n < 2) {
+    return Integer(1);
+  }
+  Integer half = FactorialOf(n / 2);
+  if (half.isOverflow()) {
+    return half;
+  }
+  return Integer::Multiplication(Integer::Multiplication(half, half), PrimePowersProduct(SwingExponent, n, 0));
+}
+
+Integer Arithmetic::Factorial(const Integer & n) {
+  assert(!n.isNegative());
+  // The factorial of an integer larger than the tabulated primes overflows
+  if (!n.isExtractable() || n.extractedInt() > LargestTabulatedPrime()) {
+    return Integer::Overflow(false);
+  }
+  return FactorialOf(n.extractedInt());
+}
+
+Integer Arithmetic::BinomialCoefficient(const Integer & n, const Integer & k) {
+  assert(!n.isNegative() && !k.isNegative());
+  if (n.isLowerThan(k)) {
+    return Integer(0);
+  }
+  Integer nMinusK = Integer::Subtraction(n, k);
+  Integer j = nMinusK.isLowerThan(k) ? nMinusK : k;
+  // binomial(n,j) ≥ 2^j overflows for large j
+  if (!j.isExtractable() || j.extractedInt() > Integer::k_maxNumberOfDigits * 32) {
+    return Integer::Overflow(false);
+  }
+  int clippedJ = j.extractedInt();
+  if (n.isExtractable() && n.extractedInt() <= LargestTabulatedPrime()) {
+    return PrimePowersProduct(BinomialExponent, n.extractedInt(), clippedJ);
+  }
+  /* Primes up to n are not tabulated: binomial(n-j+i,i) are computed one after
+   * the other, each one being an exact division of the previous one times
+   * n-j+i by i. */
+  Integer nMinusJ = Integer::Subtraction(n, j);
+  Integer result(1);
+  for (int i = 1; i <= clippedJ; i++) {
+    Integer product = Integer::Multiplication(result, Integer::Addition(nMinusJ, Integer(i)));
+    if (product.isOverflow()) {
+      return product;
+    }
+    result = Integer::Division(product, Integer(i)).quotient;
+  }
+  return result;
+}
+
+// Product of the count consecutive integers from first
+static Integer ConsecutiveIntegersProduct(const Integer & first, int count) {
+  if (count == 1) {
+    return first;
+  }
+  int half = count / 2;
+  Integer low = ConsecutiveIntegersProduct(first, half);
+  if (low.isOverflow()) {
+    return low;
+  }
+  return Integer::Multiplication(low, ConsecutiveIntegersProduct(Integer::Addition(first, Integer(half)), count - half));
+}
+
+Integer Arithmetic::PermuteCoefficient(const Integer & n, const Integer & k) {
+  assert(!n.isNegative() && !k.isNegative());
+  if (n.isLowerThan(k)) {
+    return Integer(0);
+  }
+  if (k.isZero()) {
+    return Integer(1);
+  }
+  if (n.isExtractable() && n.extractedInt() <= LargestTabulatedPrime()) {
+    return PrimePowersProduct(PermuteExponent, n.extractedInt(), k.extractedInt());
+  }
+  // permute(n,k) ≥ 2^k overflows for large k
+  if (!k.isExtractable() || k.extractedInt() > Integer::k_maxNumberOfDigits * 32) {
+    return Integer::Overflow(false);
+  }
+  // permute(n,k) = (n-k+1)×...×n
+  return ConsecutiveIntegersProduct(Integer::Addition(Integer::Subtraction(n, k), Integer(1)), k.extractedInt());
+}
+
 }
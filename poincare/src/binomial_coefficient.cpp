@@ -1,4 +1,5 @@
 #include <poincare/binomial_coefficient.h>
+#include <poincare/arithmetic.h>
 #include <poincare/binomial_coefficient_layout.h>
 #include <poincare/rational.h>
 #include <poincare/layout_helper.h>
@@ -93,23 +94,12 @@ Expression BinomialCoefficient::shallowReduce(Context * context) {
   if (n.isLowerThan(k)) {
     return replaceWithUndefinedInPlace();
   }
-  /* If n is too big, we do not reduce in order to avoid too long computation.
-   * The binomial coefficient will be approximatively evaluated later. */
-  if (Integer(k_maxNValue).isLowerThan(n)) {
+  Integer binomial = Arithmetic::BinomialCoefficient(n, k);
+  if (binomial.isOverflow()) {
+    // The binomial coefficient will be approximated
     return *this;
   }
-  Rational result = Rational::Builder(1);
-  Integer kBis = Integer::Subtraction(n, k);
-  k = kBis.isLowerThan(k) ? kBis : k;
-  int clippedK = k.extractedInt(); // Authorized because k < n < k_maxNValue
-  for (int i = 0; i < clippedK; i++) {
-    Integer nMinusI = Integer::Subtraction(n, Integer(i));
-    Integer kMinusI = Integer::Subtraction(k, Integer(i));
-    Rational factor = Rational::Builder(nMinusI, kMinusI);
-    result = Rational::Multiplication(result, factor);
-  }
-  // As we cap the n < k_maxNValue = 300, result < binomial(300, 150) ~2^89
-  assert(!result.numeratorOrDenominatorIsInfinity());
+  Rational result = Rational::Builder(binomial);
   replaceWithInPlace(result);
   return std::move(result);
 }
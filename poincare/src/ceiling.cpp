@@ -15,6 +15,10 @@ constexpr Expression::FunctionHelper Ceiling::s_functionHelper;
 
 int CeilingNode::numberOfChildren() const { return Ceiling::s_functionHelper.numberOfChildren(); }
 
+Enclosure CeilingNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Ceiling(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit));
+}
+
 Layout CeilingNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return CeilingLayout::Builder(childAtIndex(0)->createLayout(floatDisplayMode, numberOfSignificantDigits));
 }
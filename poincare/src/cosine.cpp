@@ -1,7 +1,11 @@
 #include <poincare/cosine.h>
 #include <poincare/complex.h>
 #include <poincare/layout_helper.h>
+#include <poincare/multiplication.h>
+#include <poincare/rational.h>
 #include <poincare/serialization_helper.h>
+#include <poincare/sine.h>
+#include <poincare/trigonometry.h>
 
 #include <cmath>
 
@@ -22,6 +26,14 @@ Complex<T> CosineNode::computeOnComplex(const std::complex<T> c, Preferences::Co
   return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput));
 }
 
+Enclosure CosineNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Cosine(Enclosure::Scale(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit), M_PI/Trigonometry::PiInAngleUnit(angleUnit)));
+}
+
+DualNumber CosineNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Cosine(DualNumber::Scale(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit), M_PI/Trigonometry::PiInAngleUnit(angleUnit)));
+}
+
 Layout CosineNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Prefix(Cosine(this), floatDisplayMode, numberOfSignificantDigits, Cosine::s_functionHelper.name());
 }
@@ -34,6 +46,10 @@ Expression CosineNode::shallowReduce(ReductionContext reductionContext) {
   return Cosine(this).shallowReduce(reductionContext);
 }
 
+Expression CosineNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return Cosine(this).unaryFunctionDifferential(reductionContext);
+}
+
 Expression Cosine::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
   {
     Expression e = Expression::defaultShallowReduce();
@@ -46,4 +62,10 @@ Expression Cosine::shallowReduce(ExpressionNode::ReductionContext reductionConte
 }
 
 
+
+Expression Cosine::unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const {
+  // cos'(x) = -sin(x), with x converted to radians
+  return Multiplication::Builder(Rational::Builder(-1), Trigonometry::UnitConversionFactor(reductionContext.angleUnit(), Preferences::AngleUnit::Radian), Sine::Builder(childAtIndex(0).clone()));
+}
+
 }
@@ -1,6 +1,7 @@
 #include <poincare/derivative.h>
 #include <poincare/ieee754.h>
 #include <poincare/layout_helper.h>
+#include <poincare/multiplication.h>
 #include <poincare/serialization_helper.h>
 
 #include <poincare/symbol.h>
@@ -36,7 +37,7 @@ int DerivativeNode::serialize(char * buffer, int bufferSize, Preferences::PrintF
 }
 
 Expression DerivativeNode::shallowReduce(ReductionContext reductionContext) {
-  return Derivative(this).shallowReduce(reductionContext.context());
+  return Derivative(this).shallowReduce(reductionContext);
 }
 
 template<typename T>
@@ -151,7 +152,7 @@ T DerivativeNode::riddersApproximation(Context * context, Preferences::ComplexFo
   return ans;
 }
 
-Expression Derivative::shallowReduce(Context * context) {
+Expression Derivative::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
   {
     Expression e = Expression::defaultShallowReduce();
     e = e.defaultHandleUnitsInChildren();
@@ -159,12 +160,41 @@ Expression Derivative::shallowReduce(Context * context) {
       return e;
     }
   }
+  Context * context = reductionContext.context();
   assert(!childAtIndex(1).deepIsMatrix(context));
   if (childAtIndex(0).deepIsMatrix(context) || childAtIndex(2).deepIsMatrix(context)) {
     return replaceWithUndefinedInPlace();
   }
-  // TODO: to be implemented diff(+) -> +diff() etc
-  return *this;
+  Symbol symbol = childAtIndex(1).convert<Symbol>();
+  /* The derivand is a child of the derivative: it is replaced in place with
+   * its derivative, in which the derivatives of its own children are
+   * Derivative nodes evaluated at the symbol. If no rule applies, the
+   * derivative will be approximated. */
+  if (!childAtIndex(0).derivate(reductionContext, symbol)) {
+    return *this;
+  }
+  Expression derivand = childAtIndex(0);
+  Expression value = childAtIndex(2);
+  replaceWithInPlace(derivand);
+  /* Out of the derivative, the symbol is not a parameter anymore and could be
+   * replaced by its definition in the context: it is replaced by the value
+   * before reducing. Derivatives of the children keep the symbol bound. */
+  if (value.type() != ExpressionNode::Type::Symbol || !symbol.hasSameNameAs(static_cast<Symbol &>(value))) {
+    derivand = derivand.replaceSymbolWithExpression(symbol, value);
+  }
+  return derivand.deepReduce(reductionContext);
+}
+
+bool Derivative::DerivateUnaryFunction(Expression function, const Symbol & symbol, ExpressionNode::ReductionContext reductionContext) {
+  if (function.numberOfChildren() != 1) {
+    return false;
+  }
+  Expression differential = function.unaryFunctionDifferential(reductionContext);
+  if (differential.isUninitialized()) {
+    return false;
+  }
+  function.replaceWithInPlace(Multiplication::Builder(differential, Derivative::Builder(function.childAtIndex(0).clone(), symbol.clone().convert<Symbol>(), symbol.clone())));
+  return true;
 }
 
 Expression Derivative::UntypedBuilder(Expression children) {
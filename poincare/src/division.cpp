@@ -21,6 +21,14 @@ int DivisionNode::polynomialDegree(Context * context, const char * symbolName) c
   return childAtIndex(0)->polynomialDegree(context, symbolName);
 }
 
+Enclosure DivisionNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Multiply(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit), Enclosure::Inverse(childAtIndex(1)->enclosure(x, context, complexFormat, angleUnit)));
+}
+
+DualNumber DivisionNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Multiply(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit), DualNumber::Inverse(childAtIndex(1)->dualNumber(x, context, complexFormat, angleUnit)));
+}
+
 Layout DivisionNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   const ExpressionNode * numerator = childAtIndex(0);
   const ExpressionNode * denominator = childAtIndex(1);
@@ -0,0 +1,124 @@
+#include <poincare/dual_number.h>
+#include <cmath>
+
+namespace Poincare {
+
+DualNumber::DualNumber(double value, double derivative, double secondDerivative) :
+  m_value(value),
+  m_derivative(derivative),
+  m_secondDerivative(secondDerivative)
+{
+  /* Infinite values or derivatives (1/0, √ at 0...) cannot drive a Newton
+   * step: they are as useless as undefined ones. */
+  if (!std::isfinite(m_value) || !std::isfinite(m_derivative) || !std::isfinite(m_secondDerivative)) {
+    m_value = NAN;
+    m_derivative = NAN;
+    m_secondDerivative = NAN;
+  }
+}
+
+DualNumber DualNumber::Compose(DualNumber a, double f, double df, double d2f) {
+  if (a.isUndefined()) {
+    return a;
+  }
+  // (f∘a)' = f'(a)×a' and (f∘a)'' = f''(a)×a'^2 + f'(a)×a''
+  return DualNumber(f, df * a.m_derivative, d2f * a.m_derivative * a.m_derivative + df * a.m_secondDerivative);
+}
+
+DualNumber DualNumber::Add(DualNumber a, DualNumber b) {
+  return DualNumber(a.m_value + b.m_value, a.m_derivative + b.m_derivative, a.m_secondDerivative + b.m_secondDerivative);
+}
+
+DualNumber DualNumber::Multiply(DualNumber a, DualNumber b) {
+  return DualNumber(
+      a.m_value * b.m_value,
+      a.m_derivative * b.m_value + a.m_value * b.m_derivative,
+      a.m_secondDerivative * b.m_value + 2.0 * a.m_derivative * b.m_derivative + a.m_value * b.m_secondDerivative);
+}
+
+DualNumber DualNumber::Inverse(DualNumber a) {
+  double u = a.m_value;
+  if (u == 0.0) {
+    return Undefined();
+  }
+  return Compose(a, 1.0 / u, -1.0 / (u * u), 2.0 / (u * u * u));
+}
+
+DualNumber DualNumber::Power(DualNumber base, DualNumber exponent) {
+  if (base.isUndefined() || exponent.isUndefined()) {
+    return Undefined();
+  }
+  if (exponent.isConstant()) {
+    double n = exponent.m_value;
+    if (n == 0.0) {
+      return Constant(1.0);
+    }
+    double u = base.m_value;
+    /* std::pow is NAN for a negative base and a non-integer exponent, as the
+     * real power is only defined for some rational exponents. */
+    double d2f = n == 1.0 ? 0.0 : n * (n - 1.0) * std::pow(u, n - 2.0);
+    return Compose(base, std::pow(u, n), n * std::pow(u, n - 1.0), d2f);
+  }
+  if (base.m_value <= 0.0) {
+    return Undefined();
+  }
+  // a^b = exp(b*ln(a)) for a > 0
+  return Exponential(Multiply(exponent, Logarithm(base)));
+}
+
+DualNumber DualNumber::Exponential(DualNumber a) {
+  double e = std::exp(a.m_value);
+  return Compose(a, e, e, e);
+}
+
+DualNumber DualNumber::Logarithm(DualNumber a) {
+  double u = a.m_value;
+  if (!(u > 0.0)) {
+    return Undefined();
+  }
+  return Compose(a, std::log(u), 1.0 / u, -1.0 / (u * u));
+}
+
+DualNumber DualNumber::SquareRoot(DualNumber a) {
+  double u = a.m_value;
+  if (!(u > 0.0)) {
+    // √ is not differentiable at 0
+    return u == 0.0 && a.isConstant() ? Constant(0.0) : Undefined();
+  }
+  double s = std::sqrt(u);
+  return Compose(a, s, 0.5 / s, -0.25 / (u * s));
+}
+
+DualNumber DualNumber::AbsoluteValue(DualNumber a) {
+  if (a.m_value == 0.0) {
+    return a.isConstant() ? a : Undefined();
+  }
+  return a.m_value > 0.0 ? a : Scale(a, -1.0);
+}
+
+DualNumber DualNumber::Sine(DualNumber a) {
+  double s = std::sin(a.m_value);
+  return Compose(a, s, std::cos(a.m_value), -s);
+}
+
+DualNumber DualNumber::Cosine(DualNumber a) {
+  double c = std::cos(a.m_value);
+  return Compose(a, c, -std::sin(a.m_value), -c);
+}
+
+DualNumber DualNumber::Tangent(DualNumber a) {
+  if (std::cos(a.m_value) == 0.0) {
+    return Undefined();
+  }
+  double t = std::tan(a.m_value);
+  double dt = 1.0 + t * t;
+  return Compose(a, t, dt, 2.0 * t * dt);
+}
+
+DualNumber DualNumber::ArcTangent(DualNumber a) {
+  double u = a.m_value;
+  double d = 1.0 / (1.0 + u * u);
+  return Compose(a, std::atan(u), d, -2.0 * u * d * d);
+}
+
+}
@@ -0,0 +1,211 @@
+#include <poincare/enclosure.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Poincare {
+
+Enclosure::Enclosure(double lower, double upper, Decoration decoration) :
+  m_lower(lower),
+  m_upper(upper),
+  m_decoration(decoration)
+{
+  /* Bounds computed from undefined operations (inf-inf, 0*inf...) prove
+   * nothing about the function. */
+  if (m_decoration == Decoration::Continuous && (std::isnan(m_lower) || std::isnan(m_upper) || m_lower > m_upper)) {
+    m_decoration = Decoration::Unknown;
+  }
+  if (m_decoration != Decoration::Continuous) {
+    m_lower = -INFINITY;
+    m_upper = INFINITY;
+  }
+}
+
+Enclosure Enclosure::Point(double x) {
+  if (!std::isfinite(x)) {
+    return Unknown();
+  }
+  return Enclosure(x, x);
+}
+
+Enclosure Enclosure::Add(Enclosure a, Enclosure b) {
+  return Enclosure(a.m_lower + b.m_lower, a.m_upper + b.m_upper, WorstDecoration(a.m_decoration, b.m_decoration));
+}
+
+Enclosure Enclosure::Multiply(Enclosure a, Enclosure b) {
+  Decoration decoration = WorstDecoration(a.m_decoration, b.m_decoration);
+  if (decoration != Decoration::Continuous) {
+    return Enclosure(0.0, 0.0, decoration);
+  }
+  double p[4] = {a.m_lower * b.m_lower, a.m_lower * b.m_upper, a.m_upper * b.m_lower, a.m_upper * b.m_upper};
+  return Enclosure(*std::min_element(p, p + 4), *std::max_element(p, p + 4));
+}
+
+Enclosure Enclosure::Inverse(Enclosure a) {
+  if (!a.isContinuous()) {
+    return a;
+  }
+  if (a.contains(0.0)) {
+    // 1/x diverges where the denominator vanishes
+    return Discontinuous();
+  }
+  return Enclosure(1.0 / a.m_upper, 1.0 / a.m_lower);
+}
+
+Enclosure Enclosure::IntegerPower(Enclosure base, int n) {
+  if (n < 0) {
+    return Inverse(IntegerPower(base, -n));
+  }
+  if (!base.isContinuous()) {
+    return base;
+  }
+  if (n == 0) {
+    return Point(1.0);
+  }
+  double lowerPower = std::pow(base.m_lower, n);
+  double upperPower = std::pow(base.m_upper, n);
+  if (n % 2 == 1) {
+    // Odd powers are increasing
+    return Enclosure(lowerPower, upperPower);
+  }
+  // Even powers are decreasing on negative numbers and increasing on positive numbers
+  if (base.m_lower >= 0.0) {
+    return Enclosure(lowerPower, upperPower);
+  }
+  if (base.m_upper <= 0.0) {
+    return Enclosure(upperPower, lowerPower);
+  }
+  return Enclosure(0.0, std::max(lowerPower, upperPower));
+}
+
+Enclosure Enclosure::Power(Enclosure base, Enclosure exponent) {
+  Decoration decoration = WorstDecoration(base.m_decoration, exponent.m_decoration);
+  if (decoration != Decoration::Continuous) {
+    return Enclosure(0.0, 0.0, decoration);
+  }
+  if (exponent.isPoint()) {
+    double n = exponent.m_lower;
+    if (n == std::round(n) && std::fabs(n) <= INT16_MAX) {
+      return IntegerPower(base, static_cast<int>(n));
+    }
+    /* The real power of a negative number is only defined for some rational
+     * exponents, which would require to know the exponent exactly. */
+    if (base.m_lower < 0.0) {
+      return Unknown();
+    }
+    if (n < 0.0) {
+      return Inverse(Power(base, Point(-n)));
+    }
+    // x^n is continuous and increasing on [0, inf) for n > 0
+    return Enclosure(std::pow(base.m_lower, n), std::pow(base.m_upper, n));
+  }
+  if (base.m_lower <= 0.0) {
+    return Unknown();
+  }
+  // a^b = exp(b*ln(a)) for a > 0
+  return Exponential(Multiply(exponent, Logarithm(base)));
+}
+
+Enclosure Enclosure::Monotonic(Enclosure a, double f1, double f2) {
+  if (!a.isContinuous()) {
+    return a;
+  }
+  return Enclosure(std::min(f1, f2), std::max(f1, f2));
+}
+
+Enclosure Enclosure::Exponential(Enclosure a) {
+  return Monotonic(a, std::exp(a.m_lower), std::exp(a.m_upper));
+}
+
+Enclosure Enclosure::Logarithm(Enclosure a) {
+  if (!a.isContinuous() || a.m_lower <= 0.0) {
+    // ln is not defined on the whole interval
+    return Unknown();
+  }
+  return Monotonic(a, std::log(a.m_lower), std::log(a.m_upper));
+}
+
+Enclosure Enclosure::SquareRoot(Enclosure a) {
+  if (!a.isContinuous() || a.m_lower < 0.0) {
+    return Unknown();
+  }
+  return Monotonic(a, std::sqrt(a.m_lower), std::sqrt(a.m_upper));
+}
+
+Enclosure Enclosure::AbsoluteValue(Enclosure a) {
+  if (!a.isContinuous()) {
+    return a;
+  }
+  if (a.m_lower >= 0.0) {
+    return a;
+  }
+  if (a.m_upper <= 0.0) {
+    return Enclosure(-a.m_upper, -a.m_lower);
+  }
+  return Enclosure(0.0, std::max(-a.m_lower, a.m_upper));
+}
+
+Enclosure Enclosure::Cosine(Enclosure a) {
+  if (!a.isContinuous()) {
+    return a;
+  }
+  /* Far from 0, the period is not accurately represented anymore and the
+   * position of the extrema cannot be trusted. */
+  constexpr double k_maxAccurateAngle = 1e12;
+  if (a.m_upper - a.m_lower >= 2.0 * M_PI || std::fabs(a.m_lower) > k_maxAccurateAngle || std::fabs(a.m_upper) > k_maxAccurateAngle) {
+    return Enclosure(-1.0, 1.0);
+  }
+  double lower = std::min(std::cos(a.m_lower), std::cos(a.m_upper));
+  double upper = std::max(std::cos(a.m_lower), std::cos(a.m_upper));
+  /* The extrema of cos are reached on k*π: 1 for even k, -1 for odd k. The
+   * interval is narrower than 2π so it contains at most two of them. */
+  double kMin = std::ceil(a.m_lower / M_PI);
+  double kMax = std::floor(a.m_upper / M_PI);
+  for (double k = kMin; k <= kMax && k <= kMin + 2.0; k++) {
+    if (std::fmod(k, 2.0) == 0.0) {
+      upper = 1.0;
+    } else {
+      lower = -1.0;
+    }
+  }
+  return Enclosure(lower, upper);
+}
+
+Enclosure Enclosure::Sine(Enclosure a) {
+  // sin(x) = cos(x-π/2)
+  return Cosine(Add(a, Point(-M_PI/2.0)));
+}
+
+Enclosure Enclosure::ArcTangent(Enclosure a) {
+  return Monotonic(a, std::atan(a.m_lower), std::atan(a.m_upper));
+}
+
+Enclosure Enclosure::Floor(Enclosure a) {
+  if (!a.isContinuous()) {
+    return a;
+  }
+  double lower = std::floor(a.m_lower);
+  double upper = std::floor(a.m_upper);
+  return Enclosure(lower, upper, lower == upper ? Decoration::Continuous : Decoration::Discontinuous);
+}
+
+Enclosure Enclosure::Ceiling(Enclosure a) {
+  if (!a.isContinuous()) {
+    return a;
+  }
+  double lower = std::ceil(a.m_lower);
+  double upper = std::ceil(a.m_upper);
+  return Enclosure(lower, upper, lower == upper ? Decoration::Continuous : Decoration::Discontinuous);
+}
+
+Enclosure Enclosure::FracPart(Enclosure a) {
+  if (!a.isContinuous()) {
+    return a;
+  }
+  double floorLower = std::floor(a.m_lower);
+  if (floorLower != std::floor(a.m_upper)) {
+    return Discontinuous();
+  }
+  return Enclosure(a.m_lower - floorLower, a.m_upper - floorLower);
+}
+
+}
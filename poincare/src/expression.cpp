@@ -1,8 +1,11 @@
 #include <poincare/expression.h>
 #include <poincare/expression_node.h>
+#include <poincare/float.h>
 #include <poincare/ghost.h>
+#include <poincare/n_ary_expression.h>
 #include <poincare/opposite.h>
 #include <poincare/rational.h>
+#include <poincare/reduction_memo.h>
 #include <poincare/symbol.h>
 #include <poincare/undefined.h>
 #include <poincare/variable_context.h>
@@ -817,6 +820,8 @@ Expression Expression::angleUnitToRadian(Preferences::AngleUnit angleUnit) {
 
 Expression Expression::reduce(ExpressionNode::ReductionContext reductionContext) {
   sSimplificationHasBeenInterrupted = false;
+  ReductionMemo memo;
+  reductionContext.setMemo(&memo);
   Expression result = deepReduce(reductionContext);
   if (sSimplificationHasBeenInterrupted) {
     return replaceWithUndefinedInPlace();
@@ -825,11 +830,28 @@ Expression Expression::reduce(ExpressionNode::ReductionContext reductionContext)
 }
 
 Expression Expression::deepReduce(ExpressionNode::ReductionContext reductionContext) {
+  ReductionMemo * memo = reductionContext.memo();
+  ReductionMemo::Key key;
+  Expression unreduced;
+  if (memo != nullptr) {
+    Expression reduced = memo->reducedExpression(*this, &key);
+    if (!reduced.isUninitialized()) {
+      replaceWithInPlace(reduced);
+      return reduced;
+    }
+    if (key.isValid()) {
+      unreduced = clone();
+    }
+  }
   deepReduceChildren(reductionContext);
   if (sSimplificationHasBeenInterrupted) {
     return *this;
   }
-  return shallowReduce(reductionContext);
+  Expression result = shallowReduce(reductionContext);
+  if (!unreduced.isUninitialized() && !sSimplificationHasBeenInterrupted) {
+    memo->storeReducedExpression(key, unreduced, result);
+  }
+  return result;
 }
 
 Expression Expression::deepBeautify(ExpressionNode::ReductionContext reductionContext) {
@@ -878,6 +900,64 @@ U Expression::approximateWithValueForSymbol(const char * symbol, U x, Context *
   return approximateToScalar<U>(&variableContext, complexFormat, angleUnit);
 }
 
+static bool IsConstantLeaf(const Expression e) {
+  return e.numberOfChildren() == 0 && !e.isRandom() && e.type() != ExpressionNode::Type::Symbol;
+}
+
+Expression Expression::approximateKeepingSymbols(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  ExpressionNode::Type t = type();
+  if (isRandom() || t == ExpressionNode::Type::Symbol || t == ExpressionNode::Type::Function) {
+    return *this;
+  }
+  /* The children are approximated first, so that approximating a subtree
+   * without symbols only approximates its Float children. */
+  int numberOfConstantChildren = 0;
+  const int childrenCount = numberOfChildren();
+  for (int i = 0; i < childrenCount; i++) {
+    Expression child = childAtIndex(i).approximateKeepingSymbols(context, complexFormat, angleUnit);
+    numberOfConstantChildren += IsConstantLeaf(child);
+  }
+  if (childrenCount == 0) {
+    return *this;
+  }
+  bool isAddition = t == ExpressionNode::Type::Addition;
+  if (numberOfConstantChildren < childrenCount) {
+    if (numberOfConstantChildren < 2 || (!isAddition && t != ExpressionNode::Type::Multiplication)) {
+      return *this;
+    }
+    /* The constant terms of a sum, or factors of a product, are gathered in a
+     * single Float. Scalars commute with the other children, even matrices. */
+    double value = isAddition ? 0.0 : 1.0;
+    for (int i = 0; i < childrenCount; i++) {
+      Expression child = childAtIndex(i);
+      if (IsConstantLeaf(child)) {
+        double childValue = child.approximateToScalar<double>(context, complexFormat, angleUnit);
+        value = isAddition ? value + childValue : value * childValue;
+      }
+    }
+    if (std::isnan(value)) {
+      return *this;
+    }
+    NAryExpression nAry = static_cast<NAryExpression &>(*this);
+    for (int i = childrenCount - 1; i >= 0; i--) {
+      if (IsConstantLeaf(nAry.childAtIndex(i))) {
+        nAry.removeChildAtIndexInPlace(i);
+      }
+    }
+    nAry.addChildAtIndexInPlace(Float<double>::Builder(value), 0, nAry.numberOfChildren());
+    return *this;
+  }
+  double value = approximateToScalar<double>(context, complexFormat, angleUnit);
+  if (std::isnan(value)) {
+    return *this;
+  }
+  Expression result = Float<double>::Builder(value);
+  if (!parent().isUninitialized()) {
+    replaceWithInPlace(result);
+  }
+  return result;
+}
+
 template<typename U>
 U Expression::Epsilon() {
   static U epsilon = sizeof(U) == sizeof(double) ? 1E-15 : 1E-7f;
@@ -988,6 +1068,10 @@ Coordinate2D<double> Expression::nextMinimum(const char * symbol, double start,
         const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
         const char * symbol = reinterpret_cast<const char *>(context2);
         return expression0->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit);
+      },
+      [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+        const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
+        return expression0->dualNumber(DualNumber::Variable(x), context, complexFormat, angleUnit);
       }, context, complexFormat, angleUnit);
 }
 
@@ -997,6 +1081,10 @@ Coordinate2D<double> Expression::nextMaximum(const char * symbol, double start,
         const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
         const char * symbol = reinterpret_cast<const char *>(context2);
         return -expression0->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit);
+      },
+      [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+        const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
+        return DualNumber::Scale(expression0->dualNumber(DualNumber::Variable(x), context, complexFormat, angleUnit), -1.0);
       }, context, complexFormat, angleUnit);
   return Coordinate2D<double>(minimumOfOpposite.x1(), -minimumOfOpposite.x2());
 }
@@ -1007,6 +1095,10 @@ double Expression::nextRoot(const char * symbol, double start, double step, doub
         const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
         const char * symbol = reinterpret_cast<const char *>(context2);
         return expression0->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit);
+      },
+      [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+        const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
+        return expression0->dualNumber(DualNumber::Variable(x), context, complexFormat, angleUnit);
       }, context, complexFormat, angleUnit, nullptr);
 }
 
@@ -1017,6 +1109,12 @@ Coordinate2D<double> Expression::nextIntersection(const char * symbol, double st
         const char * symbol = reinterpret_cast<const char *>(context2);
         const Expression * expression1 = reinterpret_cast<const Expression *>(context3);
         return expression0->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit)-expression1->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit);
+      },
+      [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+        const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
+        const Expression * expression1 = reinterpret_cast<const Expression *>(context3);
+        DualNumber variable = DualNumber::Variable(x);
+        return DualNumber::Add(expression0->dualNumber(variable, context, complexFormat, angleUnit), DualNumber::Scale(expression1->dualNumber(variable, context, complexFormat, angleUnit), -1.0));
       }, context, complexFormat, angleUnit, expression);
   Coordinate2D<double> result(resultAbscissa, approximateWithValueForSymbol(symbol, resultAbscissa, context, complexFormat, angleUnit));
   if (std::fabs(result.x2()) < std::fabs(step)*k_solverPrecision) {
@@ -1025,17 +1123,23 @@ Coordinate2D<double> Expression::nextIntersection(const char * symbol, double st
   return result;
 }
 
-Coordinate2D<double> Expression::nextMinimumOfExpression(const char * symbol, double start, double step, double max, Solver::ValueAtAbscissa evaluate, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression, bool lookForRootMinimum) const {
+Coordinate2D<double> Expression::nextMinimumOfExpression(const char * symbol, double start, double step, double max, Solver::ValueAtAbscissa evaluate, Solver::DualNumberAtAbscissa dualEvaluate, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression, bool lookForRootMinimum) const {
   Coordinate2D<double> result;
   if (start == max || step == 0.0) {
     return result;
   }
+  Expression derivable = cloneWithUnknownSymbol(symbol);
+  Expression derivableExpression = expression.cloneWithUnknownSymbol(symbol);
   double bracket[3];
   double x = start;
   bool endCondition = false;
   do {
     bracketMinimum(symbol, x, step, max, bracket, evaluate, context, complexFormat, angleUnit, expression);
-    result = Solver::BrentMinimum(bracket[0], bracket[2], evaluate, context, complexFormat, angleUnit, this, symbol, &expression);
+    // Newton's method needs far fewer evaluations when derivatives are known
+    result = Solver::NewtonMinimum(bracket[0], bracket[2], dualEvaluate, context, complexFormat, angleUnit, &derivable, nullptr, &derivableExpression);
+    if (std::isnan(result.x1())) {
+      result = Solver::BrentMinimum(bracket[0], bracket[2], evaluate, context, complexFormat, angleUnit, this, symbol, &expression);
+    }
     x = bracket[1];
     // Because of float approximation, exact zero is never reached
     if (std::fabs(result.x1()) < std::fabs(step)*k_solverPrecision) {
@@ -1093,17 +1197,22 @@ void Expression::bracketMinimum(const char * symbol, double start, double step,
   result[2] = NAN;
 }
 
-double Expression::nextIntersectionWithExpression(const char * symbol, double start, double step, double max, Solver::ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression) const {
+double Expression::nextIntersectionWithExpression(const char * symbol, double start, double step, double max, Solver::ValueAtAbscissa evaluation, Solver::DualNumberAtAbscissa dualEvaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression) const {
   if (start == max || step == 0.0) {
     return NAN;
   }
+  Expression derivable = cloneWithUnknownSymbol(symbol);
+  Expression derivableExpression = expression.cloneWithUnknownSymbol(symbol);
   double bracket[2];
   double result = NAN;
   static double precisionByGradUnit = 1E6;
   double x = start+step;
   do {
     bracketRoot(symbol, x, step, max, bracket, evaluation, context, complexFormat, angleUnit, expression);
-    result = Solver::BrentRoot(bracket[0], bracket[1], std::fabs(step/precisionByGradUnit), evaluation, context, complexFormat, angleUnit, this, symbol, &expression);
+    result = Solver::NewtonRoot(bracket[0], bracket[1], std::fabs(step/precisionByGradUnit), dualEvaluation, context, complexFormat, angleUnit, &derivable, nullptr, &derivableExpression);
+    if (std::isnan(result)) {
+      result = Solver::BrentRoot(bracket[0], bracket[1], std::fabs(step/precisionByGradUnit), evaluation, context, complexFormat, angleUnit, this, symbol, &expression);
+    }
     x = bracket[1];
   } while (std::isnan(result) && (step > 0.0 ? x <= max : x >= max));
 
@@ -1115,6 +1224,13 @@ double Expression::nextIntersectionWithExpression(const char * symbol, double st
           const char * symbol = reinterpret_cast<const char *>(context2);
           const Expression * expression1 = reinterpret_cast<const Expression *>(context3);
           return expression0->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit) - (expression1->isUninitialized() ? 0.0 : expression1->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit));
+        },
+        [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+          const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
+          const Expression * expression1 = reinterpret_cast<const Expression *>(context3);
+          DualNumber variable = DualNumber::Variable(x);
+          DualNumber dual1 = expression1->isUninitialized() ? DualNumber::Constant(0.0) : expression1->dualNumber(variable, context, complexFormat, angleUnit);
+          return DualNumber::Add(expression0->dualNumber(variable, context, complexFormat, angleUnit), DualNumber::Scale(dual1, -1.0));
         }, context, complexFormat, angleUnit, expression, true),
     nextMinimumOfExpression(symbol, start, step, extremumMax,
         [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
@@ -1122,6 +1238,13 @@ double Expression::nextIntersectionWithExpression(const char * symbol, double st
           const char * symbol = reinterpret_cast<const char *>(context2);
           const Expression * expression1 = reinterpret_cast<const Expression *>(context3);
           return (expression1->isUninitialized() ? 0.0 : expression1->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit)) - expression0->approximateWithValueForSymbol(symbol, x, context, complexFormat, angleUnit);
+        },
+        [](double x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+          const Expression * expression0 = reinterpret_cast<const Expression *>(context1);
+          const Expression * expression1 = reinterpret_cast<const Expression *>(context3);
+          DualNumber variable = DualNumber::Variable(x);
+          DualNumber dual1 = expression1->isUninitialized() ? DualNumber::Constant(0.0) : expression1->dualNumber(variable, context, complexFormat, angleUnit);
+          return DualNumber::Add(dual1, DualNumber::Scale(expression0->dualNumber(variable, context, complexFormat, angleUnit), -1.0));
         }, context, complexFormat, angleUnit, expression, true)};
   for (int i = 0; i < 2; i++) {
     if (!std::isnan(resultExtremum[i].x1()) && (std::isnan(result) || std::fabs(result - start) > std::fabs(resultExtremum[i].x1() - start))) {
@@ -1134,6 +1257,13 @@ double Expression::nextIntersectionWithExpression(const char * symbol, double st
   return result;
 }
 
+Expression Expression::cloneWithUnknownSymbol(const char * symbol) const {
+  if (isUninitialized()) {
+    return Expression();
+  }
+  return clone().replaceSymbolWithExpression(Symbol::Builder(symbol, strlen(symbol)), Symbol::Builder(UCodePointUnknown));
+}
+
 void Expression::bracketRoot(const char * symbol, double start, double step, double max, double result[2], Solver::ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const Expression expression) const {
   double a = start;
   double b = start+step;
@@ -3,6 +3,7 @@
 #include <poincare/addition.h>
 #include <poincare/arc_tangent.h>
 #include <poincare/complex_cartesian.h>
+#include <poincare/derivative.h>
 #include <poincare/division.h>
 #include <poincare/power.h>
 #include <poincare/rational.h>
@@ -67,6 +68,33 @@ float ExpressionNode::characteristicXRange(Context * context, Preferences::Angle
   return range;
 }
 
+Enclosure ExpressionNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  /* By default, only x-independent expressions can be enclosed: they are
+   * constant on any interval. */
+  if (isRandom()) {
+    return Enclosure::Unknown();
+  }
+  for (ExpressionNode * c : children()) {
+    if (!c->enclosure(x, context, complexFormat, angleUnit).isPoint()) {
+      return Enclosure::Unknown();
+    }
+  }
+  return Enclosure::Point(approximate(DoublePrecision(), context, complexFormat, angleUnit).toScalar());
+}
+
+DualNumber ExpressionNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  // By default, only x-independent expressions can be derived
+  if (isRandom()) {
+    return DualNumber::Undefined();
+  }
+  for (ExpressionNode * c : children()) {
+    if (!c->dualNumber(x, context, complexFormat, angleUnit).isConstant()) {
+      return DualNumber::Undefined();
+    }
+  }
+  return DualNumber::Constant(approximate(DoublePrecision(), context, complexFormat, angleUnit).toScalar());
+}
+
 int ExpressionNode::SimplificationOrder(const ExpressionNode * e1, const ExpressionNode * e2, bool ascending, bool canBeInterrupted, bool ignoreParentheses) {
   // Depending on ignoreParentheses, check if e1 or e2 are parenthesis
   ExpressionNode::Type type1 = e1->type();
@@ -148,4 +176,17 @@ Expression ExpressionNode::denominator(ReductionContext reductionContext) const
   return Expression();
 }
 
+bool ExpressionNode::didDerivate(ReductionContext reductionContext, const Symbol & symbol) {
+  // Expressions which do not depend on the symbol are constant
+  if (!isRandom() && polynomialDegree(reductionContext.context(), symbol.name()) == 0) {
+    Expression(this).replaceWithInPlace(Rational::Builder(0));
+    return true;
+  }
+  return Derivative::DerivateUnaryFunction(Expression(this), symbol, reductionContext);
+}
+
+Expression ExpressionNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return Expression();
+}
+
 }
@@ -1,4 +1,5 @@
 #include <poincare/factorial.h>
+#include <poincare/arithmetic.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/constant.h>
 #include <poincare/horizontal_layout.h>
@@ -101,11 +102,12 @@ Expression Factorial::shallowReduce(ExpressionNode::ReductionContext reductionCo
     if (!r.isInteger() || r.sign() == ExpressionNode::Sign::Negative) {
       return replaceWithUndefinedInPlace();
     }
-    if (Integer(k_maxOperandValue).isLowerThan(r.unsignedIntegerNumerator())) {
+    Integer factorial = Arithmetic::Factorial(r.unsignedIntegerNumerator());
+    if (factorial.isOverflow()) {
+      // The factorial will be approximated
       return *this;
     }
-    Rational fact = Rational::Builder(Integer::Factorial(r.unsignedIntegerNumerator()));
-    assert(!fact.numeratorOrDenominatorIsInfinity()); // because fact < k_maxOperandValue!
+    Rational fact = Rational::Builder(factorial);
     replaceWithInPlace(fact);
     return std::move(fact);
   }
@@ -15,6 +15,10 @@ constexpr Expression::FunctionHelper Floor::s_functionHelper;
 
 int FloorNode::numberOfChildren() const { return Floor::s_functionHelper.numberOfChildren(); }
 
+Enclosure FloorNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Floor(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit));
+}
+
 Layout FloorNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return FloorLayout::Builder(childAtIndex(0)->createLayout(floatDisplayMode, numberOfSignificantDigits));
 }
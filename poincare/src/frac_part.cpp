@@ -11,6 +11,10 @@ constexpr Expression::FunctionHelper FracPart::s_functionHelper;
 
 int FracPartNode::numberOfChildren() const { return FracPart::s_functionHelper.numberOfChildren(); }
 
+Enclosure FracPartNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::FracPart(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit));
+}
+
 Layout FracPartNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Prefix(FracPart(this), floatDisplayMode, numberOfSignificantDigits, FracPart::s_functionHelper.name());
 }
@@ -1,4 +1,5 @@
 #include <poincare/hyperbolic_cosine.h>
+#include <poincare/hyperbolic_sine.h>
 #include <poincare/layout_helper.h>
 #include <poincare/serialization_helper.h>
 
@@ -14,6 +15,14 @@ int HyperbolicCosineNode::serialize(char * buffer, int bufferSize, Preferences::
   return SerializationHelper::Prefix(this, buffer, bufferSize, floatDisplayMode, numberOfSignificantDigits, HyperbolicCosine::s_functionHelper.name());
 }
 
+Expression HyperbolicCosineNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return HyperbolicCosine(this).unaryFunctionDifferential(reductionContext);
+}
+
+Expression HyperbolicCosine::unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const {
+  return HyperbolicSine::Builder(childAtIndex(0).clone());
+}
+
 template<typename T>
 Complex<T> HyperbolicCosineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(std::cosh(c), c));
@@ -1,4 +1,5 @@
 #include <poincare/hyperbolic_sine.h>
+#include <poincare/hyperbolic_cosine.h>
 #include <poincare/layout_helper.h>
 #include <poincare/serialization_helper.h>
 
@@ -14,6 +15,14 @@ int HyperbolicSineNode::serialize(char * buffer, int bufferSize, Preferences::Pr
   return SerializationHelper::Prefix(this, buffer, bufferSize, floatDisplayMode, numberOfSignificantDigits, HyperbolicSine::s_functionHelper.name());
 }
 
+Expression HyperbolicSineNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return HyperbolicSine(this).unaryFunctionDifferential(reductionContext);
+}
+
+Expression HyperbolicSine::unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const {
+  return HyperbolicCosine::Builder(childAtIndex(0).clone());
+}
+
 template<typename T>
 Complex<T> HyperbolicSineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(std::sinh(c), c));
@@ -1,5 +1,8 @@
 #include <poincare/hyperbolic_tangent.h>
+#include <poincare/hyperbolic_cosine.h>
 #include <poincare/layout_helper.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
 #include <poincare/serialization_helper.h>
 
 namespace Poincare {
@@ -14,6 +17,15 @@ int HyperbolicTangentNode::serialize(char * buffer, int bufferSize, Preferences:
   return SerializationHelper::Prefix(this, buffer, bufferSize, floatDisplayMode, numberOfSignificantDigits, HyperbolicTangent::s_functionHelper.name());
 }
 
+Expression HyperbolicTangentNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return HyperbolicTangent(this).unaryFunctionDifferential(reductionContext);
+}
+
+Expression HyperbolicTangent::unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const {
+  // tanh'(x) = 1/cosh(x)^2
+  return Power::Builder(HyperbolicCosine::Builder(childAtIndex(0).clone()), Rational::Builder(-2));
+}
+
 template<typename T>
 Complex<T> HyperbolicTangentNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(std::tanh(c), c));
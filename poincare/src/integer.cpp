@@ -436,20 +436,6 @@ Integer Integer::Power(const Integer & i, const Integer & j) {
   return result;
 }
 
-Integer Integer::Factorial(const Integer & i) {
-  assert(!i.isNegative());
-  if (i.isOverflow()) {
-    return Overflow(false);
-  }
-  Integer j(2);
-  Integer result(1);
-  while (ucmp(i,j) >= 0) {
-    result = Multiplication(j, result);
-    j = usum(j, Integer(1), false);
-  }
-  return result;
-}
-
 Integer Integer::addition(const Integer & a, const Integer & b, bool inverseBNegative, bool oneDigitOverflow) {
   bool bNegative = (inverseBNegative ? !b.m_negative : b.m_negative);
   if (a.m_negative == bNegative) {
@@ -3,6 +3,7 @@
 #include <poincare/approximation_helper.h>
 #include <poincare/arithmetic.h>
 #include <poincare/constant.h>
+#include <poincare/derivative.h>
 #include <poincare/division.h>
 #include <poincare/infinity.h>
 #include <poincare/layout_helper.h>
@@ -48,6 +49,19 @@ int LogarithmNode<T>::serialize(char * buffer, int bufferSize, Preferences::Prin
   return SerializationHelper::Prefix(this, buffer, bufferSize, floatDisplayMode, numberOfSignificantDigits, T == 1 ? CommonLogarithm::s_functionHelper.name() : Logarithm::s_functionHelper.name());
 }
 
+template<int T>
+Enclosure LogarithmNode<T>::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  Enclosure base = T == 1 ? Enclosure::Point(10.0) : childAtIndex(1)->enclosure(x, context, complexFormat, angleUnit);
+  // log(a, b) = ln(a)/ln(b)
+  return Enclosure::Multiply(Enclosure::Logarithm(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit)), Enclosure::Inverse(Enclosure::Logarithm(base)));
+}
+
+template<int T>
+DualNumber LogarithmNode<T>::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  DualNumber base = T == 1 ? DualNumber::Constant(10.0) : childAtIndex(1)->dualNumber(x, context, complexFormat, angleUnit);
+  return DualNumber::Multiply(DualNumber::Logarithm(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit)), DualNumber::Inverse(DualNumber::Logarithm(base)));
+}
+
 template<>
 void LogarithmNode<2>::deepReduceChildren(ExpressionNode::ReductionContext reductionContext) {
   Logarithm(this).deepReduceChildren(reductionContext);
@@ -68,6 +82,17 @@ Expression LogarithmNode<2>::shallowReduce(ExpressionNode::ReductionContext redu
   return Logarithm(this).shallowReduce(reductionContext);
 }
 
+template<>
+bool LogarithmNode<1>::didDerivate(ReductionContext reductionContext, const Symbol & symbol) {
+  // log(x) is reduced into log(x,10) before being derivated
+  return ExpressionNode::didDerivate(reductionContext, symbol);
+}
+
+template<>
+bool LogarithmNode<2>::didDerivate(ReductionContext reductionContext, const Symbol & symbol) {
+  return Logarithm(this).derivate(reductionContext, symbol);
+}
+
 template<>
 Expression LogarithmNode<1>::shallowBeautify(ReductionContext reductionContext) {
   return CommonLogarithm(this);
@@ -238,6 +263,22 @@ Expression Logarithm::shallowReduce(ExpressionNode::ReductionContext reductionCo
   return *this;
 }
 
+bool Logarithm::derivate(ExpressionNode::ReductionContext reductionContext, const Symbol & symbol) {
+  Expression argument = childAtIndex(0);
+  Expression base = childAtIndex(1);
+  if (base.polynomialDegree(reductionContext.context(), symbol.name()) != 0) {
+    return false;
+  }
+  /* f'/f is defined for negative values of f, unlike ln(f) in real mode: the
+   * derivative would then be real where the function is not. */
+  if (reductionContext.complexFormat() == Preferences::ComplexFormat::Real && argument.sign(reductionContext.context()) != ExpressionNode::Sign::Positive) {
+    return false;
+  }
+  // log(f,b)' = f'/(f×ln(b))
+  replaceWithInPlace(Multiplication::Builder(Derivative::Builder(argument.clone(), symbol.clone().convert<Symbol>(), symbol.clone()), Power::Builder(argument.clone(), Rational::Builder(-1)), Power::Builder(NaperianLogarithm::Builder(base.clone()), Rational::Builder(-1))));
+  return true;
+}
+
 Expression Logarithm::simpleShallowReduce(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
   Expression c = childAtIndex(0);
   Expression b = childAtIndex(1);
@@ -385,6 +426,10 @@ template Evaluation<float> LogarithmNode<1>::templatedApproximate<float>(Poincar
 template Evaluation<double> LogarithmNode<1>::templatedApproximate<double>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
 template Evaluation<float> LogarithmNode<2>::templatedApproximate<float>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
 template Evaluation<double> LogarithmNode<2>::templatedApproximate<double>(Poincare::Context *, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit) const;
+template Enclosure LogarithmNode<1>::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template Enclosure LogarithmNode<2>::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template DualNumber LogarithmNode<1>::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+template DualNumber LogarithmNode<2>::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
 template int LogarithmNode<1>::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const;
 template int LogarithmNode<2>::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const;
 
@@ -2,6 +2,7 @@
 #include <poincare/addition.h>
 #include <poincare/division.h>
 #include <poincare/exception_checkpoint.h>
+#include <poincare/matrix_array.h>
 #include <poincare/matrix_complex.h>
 #include <poincare/matrix_layout.h>
 #include <poincare/multiplication.h>
@@ -152,32 +153,7 @@ int Matrix::ArrayInverse(T * array, int numberOfRows, int numberOfColumns) {
     return -1;
   }
   assert(numberOfRows*numberOfColumns <= k_maxNumberOfCoefficients);
-  int dim = numberOfRows;
-  /* Create the matrix inv = (A|I) with A the input matrix and I the dim identity matrix
-   * (A is squared with less than k_maxNumberOfCoefficients so (A|I) has less than
-   * 2*k_maxNumberOfCoefficients */
-  T operands[2*k_maxNumberOfCoefficients];
-  for (int i = 0; i < dim; i++) {
-    for (int j = 0; j < dim; j++) {
-      operands[i*2*dim+j] = array[i*numberOfColumns+j];
-    }
-    for (int j = dim; j < 2*dim; j++) {
-      operands[i*2*dim+j] = j-dim == i ? 1.0 : 0.0;
-    }
-  }
-  ArrayRowCanonize(operands, dim, 2*dim);
-  // Check inversibility
-  for (int i = 0; i < dim; i++) {
-    if (std::abs(operands[i*2*dim+i] - (T)1.0) > Expression::Epsilon<float>()) {
-      return -2;
-    }
-  }
-  for (int i = 0; i < dim; i++) {
-    for (int j = 0; j < dim; j++) {
-      array[i*numberOfColumns+j] = operands[i*2*dim+j+dim];
-    }
-  }
-  return 0;
+  return MatrixArray::Inverse(array, numberOfRows) ? 0 : -2;
 }
 
 Matrix Matrix::rowCanonize(ExpressionNode::ReductionContext reductionContext, Expression * determinant) {
@@ -254,58 +230,6 @@ Matrix Matrix::rowCanonize(ExpressionNode::ReductionContext reductionContext, Ex
   return *this;
 }
 
-template<typename T>
-void Matrix::ArrayRowCanonize(T * array, int numberOfRows, int numberOfColumns, T * determinant) {
-  int h = 0; // row pivot
-  int k = 0; // column pivot
-
-  while (h < numberOfRows && k < numberOfColumns) {
-    // Find the first non-null pivot
-    int iPivot = h;
-    while (iPivot < numberOfRows && std::abs(array[iPivot*numberOfColumns+k]) < Expression::Epsilon<double>()) {
-      iPivot++;
-    }
-    if (iPivot == numberOfRows) {
-      // No non-null coefficient in this column, skip
-      k++;
-      // Update determinant: det *= 0
-      if (determinant) { *determinant *= (T)0.0; }
-    } else {
-      // Swap row h and iPivot
-      if (iPivot != h) {
-        for (int col = h; col < numberOfColumns; col++) {
-          // Swap array[iPivot, col] and array[h, col]
-          T temp = array[iPivot*numberOfColumns+col];
-          array[iPivot*numberOfColumns+col] = array[h*numberOfColumns+col];
-          array[h*numberOfColumns+col] = temp;
-        }
-        // Update determinant: det *= -1
-        if (determinant) { *determinant *= (T)-1.0; }
-      }
-      // Set to 1 array[h][k] by linear combination
-      T divisor = array[h*numberOfColumns+k];
-      // Update determinant: det *= divisor
-      if (determinant) { *determinant *= divisor; }
-      for (int j = k+1; j < numberOfColumns; j++) {
-        array[h*numberOfColumns+j] /= divisor;
-      }
-      array[h*numberOfColumns+k] = 1;
-
-      /* Set to 0 all M[i][j] i != h, j > k by linear combination */
-      for (int i = 0; i < numberOfRows; i++) {
-        if (i == h) { continue; }
-        T factor = array[i*numberOfColumns+k];
-        for (int j = k+1; j < numberOfColumns; j++) {
-          array[i*numberOfColumns+j] -= array[h*numberOfColumns+j]*factor;
-        }
-        array[i*numberOfColumns+k] = 0;
-      }
-      h++;
-      k++;
-    }
-  }
-}
-
 Matrix Matrix::CreateIdentity(int dim) {
   Matrix matrix = Matrix::Builder();
   for (int i = 0; i < dim; i++) {
@@ -479,7 +403,5 @@ template int Matrix::ArrayInverse<float>(float *, int, int);
 template int Matrix::ArrayInverse<double>(double *, int, int);
 template int Matrix::ArrayInverse<std::complex<float>>(std::complex<float> *, int, int);
 template int Matrix::ArrayInverse<std::complex<double>>(std::complex<double> *, int, int);
-template void Matrix::ArrayRowCanonize<std::complex<float> >(std::complex<float>*, int, int, std::complex<float>*);
-template void Matrix::ArrayRowCanonize<std::complex<double> >(std::complex<double>*, int, int, std::complex<double>*);
 
 }
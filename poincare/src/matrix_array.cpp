@@ -0,0 +1,257 @@
+#include <poincare/matrix_array.h>
+#include <poincare/expression.h>
+#include <poincare/matrix.h>
+#include <poincare/matrix_complex.h>
+#include <assert.h>
+#include <cmath>
+#include <complex>
+#include <utility>
+
+namespace Poincare {
+
+namespace MatrixArray {
+
+/* Square matrices handled by LU fit in Matrix::k_maxNumberOfCoefficients,
+ * which bounds the per-row workspace. */
+constexpr static int k_maxDimension = 20;
+static_assert(k_maxDimension * k_maxDimension >= Matrix::k_maxNumberOfCoefficients, "The LU workspace is too small");
+
+/* The product is computed by tiles of k_blockSize inner coefficients and
+ * columns so that the rows of b involved stay in the data cache while a tile
+ * of the result is accumulated. */
+constexpr static int k_blockSize = 8;
+
+/* Threshold pivoting: the diagonal coefficient is kept as pivot unless it is
+ * smaller than k_pivotThreshold times the largest coefficient of its column.
+ * This still bounds the multipliers, but does not swap the rows of
+ * well-conditioned integer matrices, whose inverse would otherwise lose its
+ * exact coefficients to rounding. */
+constexpr static float k_pivotThreshold = 0.1f;
+
+/* Small matrices, then the matrices of the former 10x10 cap, do not reserve
+ * the stack of the largest ones. */
+constexpr static int k_smallBufferCapacity = 16;
+constexpr static int k_mediumBufferCapacity = 100;
+
+template<int Capacity, typename R, typename T>
+__attribute__((noinline)) static R WithBufferOfCapacity(R (*action)(T *, const void *, const void *), const void * context1, const void * context2) {
+  T buffer[Capacity];
+  return action(buffer, context1, context2);
+}
+
+template<typename R, typename T>
+R WithBuffer(int numberOfCoefficients, R (*action)(T * buffer, const void * context1, const void * context2), const void * context1, const void * context2) {
+  if (numberOfCoefficients <= k_smallBufferCapacity) {
+    return WithBufferOfCapacity<k_smallBufferCapacity>(action, context1, context2);
+  }
+  if (numberOfCoefficients <= k_mediumBufferCapacity) {
+    return WithBufferOfCapacity<k_mediumBufferCapacity>(action, context1, context2);
+  }
+  assert(numberOfCoefficients <= Matrix::k_maxNumberOfCoefficients);
+  return WithBufferOfCapacity<Matrix::k_maxNumberOfCoefficients>(action, context1, context2);
+}
+
+template<typename T>
+void Multiply(const T * a, const T * b, T * result, int numberOfRows, int numberOfInnerCoefficients, int numberOfColumns) {
+  assert(result != a && result != b);
+  for (int i = 0; i < numberOfRows*numberOfColumns; i++) {
+    result[i] = 0;
+  }
+  for (int kBlock = 0; kBlock < numberOfInnerCoefficients; kBlock += k_blockSize) {
+    int kEnd = kBlock + k_blockSize < numberOfInnerCoefficients ? kBlock + k_blockSize : numberOfInnerCoefficients;
+    for (int jBlock = 0; jBlock < numberOfColumns; jBlock += k_blockSize) {
+      int jEnd = jBlock + k_blockSize < numberOfColumns ? jBlock + k_blockSize : numberOfColumns;
+      for (int i = 0; i < numberOfRows; i++) {
+        T * resultRow = result + i*numberOfColumns;
+        for (int k = kBlock; k < kEnd; k++) {
+          T aik = a[i*numberOfInnerCoefficients+k];
+          const T * bRow = b + k*numberOfColumns;
+          for (int j = jBlock; j < jEnd; j++) {
+            resultRow[j] += aik*bRow[j];
+          }
+        }
+      }
+    }
+  }
+}
+
+template<typename T>
+bool Power(T * base, T * result, T * scratch, int dim, uint32_t exponent) {
+  assert(base != result && base != scratch && result != scratch);
+  int numberOfCoefficients = dim*dim;
+  T * power = result;
+  bool powerIsIdentity = true;
+  while (exponent > 0) {
+    if (Expression::ShouldStopProcessing()) {
+      return false;
+    }
+    if (exponent & 1) {
+      if (powerIsIdentity) {
+        for (int i = 0; i < numberOfCoefficients; i++) {
+          power[i] = base[i];
+        }
+        powerIsIdentity = false;
+      } else {
+        Multiply(power, base, scratch, dim, dim, dim);
+        std::swap(power, scratch);
+      }
+    }
+    exponent >>= 1;
+    if (exponent > 0) {
+      Multiply(base, base, scratch, dim, dim, dim);
+      std::swap(base, scratch);
+    }
+  }
+  if (powerIsIdentity) {
+    for (int i = 0; i < numberOfCoefficients; i++) {
+      result[i] = i % (dim + 1) == 0 ? 1 : 0;
+    }
+  } else if (power != result) {
+    for (int i = 0; i < numberOfCoefficients; i++) {
+      result[i] = power[i];
+    }
+  }
+  return true;
+}
+
+template<typename T>
+int LUDecompose(T * array, int dim, int * pivots) {
+  typedef decltype(std::abs(T())) Real;
+  /* Pivots are compared to the largest coefficient so that scaling the matrix
+   * does not change its invertibility. */
+  Real largestCoefficient = 0;
+  for (int i = 0; i < dim*dim; i++) {
+    Real a = std::abs(array[i]);
+    if (std::isnan(a)) {
+      return 0;
+    }
+    largestCoefficient = a > largestCoefficient ? a : largestCoefficient;
+  }
+  Real tolerance = Expression::Epsilon<Real>() * largestCoefficient;
+  int sign = 1;
+  for (int k = 0; k < dim; k++) {
+    int pivot = k;
+    Real pivotNorm = std::abs(array[k*dim+k]);
+    for (int i = k+1; i < dim; i++) {
+      Real norm = std::abs(array[i*dim+k]);
+      if (norm > pivotNorm) {
+        pivot = i;
+        pivotNorm = norm;
+      }
+    }
+    Real diagonalNorm = std::abs(array[k*dim+k]);
+    if (pivot != k && diagonalNorm >= k_pivotThreshold * pivotNorm) {
+      pivot = k;
+      pivotNorm = diagonalNorm;
+    }
+    pivots[k] = pivot;
+    if (pivotNorm <= tolerance) {
+      return 0;
+    }
+    if (pivot != k) {
+      for (int j = 0; j < dim; j++) {
+        std::swap(array[k*dim+j], array[pivot*dim+j]);
+      }
+      sign = -sign;
+    }
+    T inversePivot = (T)1 / array[k*dim+k];
+    for (int i = k+1; i < dim; i++) {
+      T factor = array[i*dim+k] * inversePivot;
+      array[i*dim+k] = factor;
+      for (int j = k+1; j < dim; j++) {
+        array[i*dim+j] -= factor * array[k*dim+j];
+      }
+    }
+  }
+  return sign;
+}
+
+template<typename T>
+T Determinant(T * array, int dim) {
+  assert(dim <= k_maxDimension);
+  int pivots[k_maxDimension];
+  int sign = LUDecompose(array, dim, pivots);
+  if (sign == 0) {
+    for (int i = 0; i < dim*dim; i++) {
+      // A NaN coefficient makes the determinant undefined rather than null
+      if (std::isnan(std::abs(array[i]))) {
+        return std::abs(array[i]);
+      }
+    }
+    return 0;
+  }
+  T determinant = sign;
+  for (int k = 0; k < dim; k++) {
+    determinant *= array[k*dim+k];
+  }
+  return determinant;
+}
+
+template<typename T>
+bool Inverse(T * array, int dim) {
+  assert(dim <= k_maxDimension);
+  int pivots[k_maxDimension];
+  if (LUDecompose(array, dim, pivots) == 0) {
+    return false;
+  }
+  // Inverse U in place, column by column
+  for (int j = 0; j < dim; j++) {
+    array[j*dim+j] = (T)1 / array[j*dim+j];
+    T minusDiagonal = -array[j*dim+j];
+    /* U^-1[0..j-1][j] = -U^-1[0..j-1][0..j-1] * U[0..j-1][j] / U[j][j]. Going
+     * down the column only reads coefficients which are not overwritten yet. */
+    for (int i = 0; i < j; i++) {
+      T sum = 0;
+      for (int k = i; k < j; k++) {
+        sum += array[i*dim+k] * array[k*dim+j];
+      }
+      array[i*dim+j] = sum * minusDiagonal;
+    }
+  }
+  // Solve X*L = U^-1, from the last column to the first one
+  T multipliers[k_maxDimension];
+  for (int j = dim-2; j >= 0; j--) {
+    for (int i = j+1; i < dim; i++) {
+      multipliers[i] = array[i*dim+j];
+      array[i*dim+j] = 0;
+    }
+    for (int r = 0; r < dim; r++) {
+      T sum = 0;
+      for (int i = j+1; i < dim; i++) {
+        sum += array[r*dim+i] * multipliers[i];
+      }
+      array[r*dim+j] -= sum;
+    }
+  }
+  // A^-1 = X*P: undo the row swaps on the columns, in reverse order
+  for (int k = dim-2; k >= 0; k--) {
+    if (pivots[k] != k) {
+      for (int r = 0; r < dim; r++) {
+        std::swap(array[r*dim+k], array[r*dim+pivots[k]]);
+      }
+    }
+  }
+  return true;
+}
+
+template std::complex<float> WithBuffer<std::complex<float>, std::complex<float>>(int, std::complex<float> (*)(std::complex<float> *, const void *, const void *), const void *, const void *);
+template std::complex<double> WithBuffer<std::complex<double>, std::complex<double>>(int, std::complex<double> (*)(std::complex<double> *, const void *, const void *), const void *, const void *);
+template MatrixComplex<float> WithBuffer<MatrixComplex<float>, std::complex<float>>(int, MatrixComplex<float> (*)(std::complex<float> *, const void *, const void *), const void *, const void *);
+template MatrixComplex<double> WithBuffer<MatrixComplex<double>, std::complex<double>>(int, MatrixComplex<double> (*)(std::complex<double> *, const void *, const void *), const void *, const void *);
+template void Multiply<double>(const double *, const double *, double *, int, int, int);
+template void Multiply<std::complex<float>>(const std::complex<float> *, const std::complex<float> *, std::complex<float> *, int, int, int);
+template void Multiply<std::complex<double>>(const std::complex<double> *, const std::complex<double> *, std::complex<double> *, int, int, int);
+template bool Power<std::complex<float>>(std::complex<float> *, std::complex<float> *, std::complex<float> *, int, uint32_t);
+template bool Power<std::complex<double>>(std::complex<double> *, std::complex<double> *, std::complex<double> *, int, uint32_t);
+template int LUDecompose<std::complex<float>>(std::complex<float> *, int, int *);
+template int LUDecompose<std::complex<double>>(std::complex<double> *, int, int *);
+template std::complex<float> Determinant<std::complex<float>>(std::complex<float> *, int);
+template std::complex<double> Determinant<std::complex<double>>(std::complex<double> *, int);
+template bool Inverse<float>(float *, int);
+template bool Inverse<double>(double *, int);
+template bool Inverse<std::complex<float>>(std::complex<float> *, int);
+template bool Inverse<std::complex<double>>(std::complex<double> *, int);
+
+}
+
+}
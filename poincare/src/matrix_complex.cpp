@@ -1,5 +1,6 @@
 #include <poincare/matrix_complex.h>
 #include <poincare/matrix.h>
+#include <poincare/matrix_array.h>
 #include <poincare/expression.h>
 #include <poincare/undefined.h>
 #include <ion.h>
@@ -74,13 +75,12 @@ std::complex<T> MatrixComplexNode<T>::determinant() const {
   if (numberOfRows() != numberOfColumns() || numberOfChildren() == 0 || numberOfChildren() > Matrix::k_maxNumberOfCoefficients) {
     return std::complex<T>(NAN, NAN);
   }
-  std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
-  for (int i = 0; i < numberOfChildren(); i++) {
-    operandsCopy[i] = complexAtIndex(i); // Returns complex<T>(NAN, NAN) if Node type is not Complex
-  }
-  std::complex<T> determinant = std::complex<T>(1);
-  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, &determinant);
-  return determinant;
+  return MatrixArray::WithBuffer<std::complex<T>, std::complex<T>>(numberOfChildren(),
+      [](std::complex<T> * operandsCopy, const void * matrix, const void * context2) -> std::complex<T> {
+        const MatrixComplexNode<T> * m = static_cast<const MatrixComplexNode<T> *>(matrix);
+        m->copyOperands(operandsCopy);
+        return MatrixArray::Determinant(operandsCopy, m->m_numberOfRows);
+      }, this);
 }
 
 template<typename T>
@@ -88,22 +88,33 @@ MatrixComplex<T> MatrixComplexNode<T>::inverse() const {
   if (numberOfRows() != numberOfColumns() || numberOfChildren() == 0 || numberOfChildren() > Matrix::k_maxNumberOfCoefficients) {
     return MatrixComplex<T>::Undefined();
   }
-  std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
+  return MatrixArray::WithBuffer<MatrixComplex<T>, std::complex<T>>(numberOfChildren(),
+      [](std::complex<T> * operandsCopy, const void * matrix, const void * context2) -> MatrixComplex<T> {
+        const MatrixComplexNode<T> * m = static_cast<const MatrixComplexNode<T> *>(matrix);
+        if (!m->copyOperands(operandsCopy) || !MatrixArray::Inverse(operandsCopy, m->m_numberOfRows)) {
+          return MatrixComplex<T>::Undefined();
+        }
+        /* Intentionally swapping dimensions for inverse, although it doesn't
+         * make a difference because it is square. */
+        return MatrixComplex<T>::Builder(operandsCopy, m->m_numberOfColumns, m->m_numberOfRows);
+      }, this);
+}
+
+template<typename T>
+bool MatrixComplexNode<T>::copyOperands(std::complex<T> * operands) const {
+  bool allComplexes = true;
   int i = 0;
+  // Iterating on the children avoids looking each of them up from the first one
   for (EvaluationNode<T> * c : this->children()) {
-    if (c->type() != EvaluationNode<T>::Type::Complex) {
-      return MatrixComplex<T>::Undefined();
+    if (c->type() == EvaluationNode<T>::Type::Complex) {
+      operands[i] = *(static_cast<ComplexNode<T> *>(c));
+    } else {
+      operands[i] = std::complex<T>(NAN, NAN);
+      allComplexes = false;
     }
-    operandsCopy[i] = complexAtIndex(i);
     i++;
   }
-  int result = Matrix::ArrayInverse(operandsCopy, m_numberOfRows, m_numberOfColumns);
-  if (result == 0) {
-    /* Intentionally swapping dimensions for inverse, although it doesn't make a
-     * difference because it is square. */
-    return MatrixComplex<T>::Builder(operandsCopy, m_numberOfColumns, m_numberOfRows);
-  }
-  return MatrixComplex<T>::Undefined();
+  return allComplexes;
 }
 
 template<typename T>
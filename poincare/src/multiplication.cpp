@@ -1,11 +1,13 @@
 #include <poincare/multiplication.h>
 #include <poincare/addition.h>
 #include <poincare/arithmetic.h>
+#include <poincare/derivative.h>
 #include <poincare/division.h>
 #include <poincare/float.h>
 #include <poincare/infinity.h>
 #include <poincare/layout_helper.h>
 #include <poincare/matrix.h>
+#include <poincare/matrix_array.h>
 #include <poincare/opposite.h>
 #include <poincare/parenthesis.h>
 #include <poincare/power.h>
@@ -74,6 +76,23 @@ MatrixComplex<T> MultiplicationNode::computeOnMatrices(const MatrixComplex<T> m,
   if (m.numberOfColumns() != n.numberOfRows()) {
     return MatrixComplex<T>::Undefined();
   }
+  int mNumberOfCoefficients = m.numberOfRows()*m.numberOfColumns();
+  int nNumberOfCoefficients = n.numberOfRows()*n.numberOfColumns();
+  int resultNumberOfCoefficients = m.numberOfRows()*n.numberOfColumns();
+  if (mNumberOfCoefficients + nNumberOfCoefficients + resultNumberOfCoefficients <= Matrix::k_maxNumberOfCoefficients) {
+    return MatrixArray::WithBuffer<MatrixComplex<T>, std::complex<T>>(mNumberOfCoefficients + nNumberOfCoefficients + resultNumberOfCoefficients,
+        [](std::complex<T> * operands, const void * context1, const void * context2) -> MatrixComplex<T> {
+          const MatrixComplex<T> * m = static_cast<const MatrixComplex<T> *>(context1);
+          const MatrixComplex<T> * n = static_cast<const MatrixComplex<T> *>(context2);
+          std::complex<T> * mOperands = operands;
+          std::complex<T> * nOperands = mOperands + m->numberOfRows()*m->numberOfColumns();
+          std::complex<T> * resultOperands = nOperands + n->numberOfRows()*n->numberOfColumns();
+          m->copyOperands(mOperands);
+          n->copyOperands(nOperands);
+          MatrixArray::Multiply(mOperands, nOperands, resultOperands, m->numberOfRows(), m->numberOfColumns(), n->numberOfColumns());
+          return MatrixComplex<T>::Builder(resultOperands, m->numberOfRows(), n->numberOfColumns());
+        }, &m, &n);
+  }
   MatrixComplex<T> result = MatrixComplex<T>::Builder();
   for (int i = 0; i < m.numberOfRows(); i++) {
     for (int j = 0; j < n.numberOfColumns(); j++) {
@@ -212,6 +231,22 @@ CodePoint MultiplicationNode::operatorSymbol() const {
   }
 }
 
+Enclosure MultiplicationNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  Enclosure result = Enclosure::Point(1.0);
+  for (ExpressionNode * c : children()) {
+    result = Enclosure::Multiply(result, c->enclosure(x, context, complexFormat, angleUnit));
+  }
+  return result;
+}
+
+DualNumber MultiplicationNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  DualNumber result = DualNumber::Constant(1.0);
+  for (ExpressionNode * c : children()) {
+    result = DualNumber::Multiply(result, c->dualNumber(x, context, complexFormat, angleUnit));
+  }
+  return result;
+}
+
 Layout  MultiplicationNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   constexpr int stringMaxSize = CodePoint::MaxCodePointCharLength + 1;
   char string[stringMaxSize];
@@ -230,6 +265,10 @@ Expression MultiplicationNode::shallowReduce(ReductionContext reductionContext)
   return Multiplication(this).shallowReduce(reductionContext);
 }
 
+bool MultiplicationNode::didDerivate(ReductionContext reductionContext, const Symbol & symbol) {
+  return Multiplication(this).derivate(reductionContext, symbol);
+}
+
 Expression MultiplicationNode::shallowBeautify(ReductionContext reductionContext) {
   return Multiplication(this).shallowBeautify(reductionContext);
 }
@@ -262,15 +301,28 @@ int Multiplication::getPolynomialCoefficients(Context * context, const char * sy
       Addition a = Addition::Builder();
       int jbis = j > degI ? degI : j;
       for (int l = 0; l <= jbis ; l++) {
+        /* Most coefficients of a monomial are null: skipping the null products
+         * keeps the size of the coefficients linear in the degree. */
+        if (intermediateCoefficients[l].isRationalZero() || coefficients[j-l].isRationalZero()) {
+          continue;
+        }
         // Always copy the a and b coefficients are they are used multiple times
         a.addChildAtIndexInPlace(Multiplication::Builder(intermediateCoefficients[l].clone(), coefficients[j-l].clone()), a.numberOfChildren(), a.numberOfChildren());
       }
       /* a(j) and b(j) are used only to compute coefficient at rank >= j, we
        * can delete them as we compute new coefficient by decreasing ranks. */
-      coefficients[j] = a;
+      if (a.numberOfChildren() == 0) {
+        coefficients[j] = Rational::Builder(0);
+      } else {
+        coefficients[j] = a;
+      }
     }
     // new coefficients[0] = a(0)*b(0)
-    coefficients[0] = Multiplication::Builder(coefficients[0], intermediateCoefficients[0]);
+    if (coefficients[0].isRationalZero() || intermediateCoefficients[0].isRationalZero()) {
+      coefficients[0] = Rational::Builder(0);
+    } else {
+      coefficients[0] = Multiplication::Builder(coefficients[0], intermediateCoefficients[0]);
+    }
   }
   return deg;
 }
@@ -311,15 +363,7 @@ Expression Multiplication::removeUnit(Expression * unit) {
 
 template<typename T>
 void Multiplication::computeOnArrays(T * m, T * n, T * result, int mNumberOfColumns, int mNumberOfRows, int nNumberOfColumns) {
-  for (int i = 0; i < mNumberOfRows; i++) {
-    for (int j = 0; j < nNumberOfColumns; j++) {
-      T res = 0.0f;
-      for (int k = 0; k < mNumberOfColumns; k++) {
-        res+= m[i*mNumberOfColumns+k]*n[k*nNumberOfColumns+j];
-      }
-      result[i*nNumberOfColumns+j] = res;
-    }
-  }
+  MatrixArray::Multiply(m, n, result, mNumberOfRows, mNumberOfColumns, nNumberOfColumns);
 }
 
 Expression Multiplication::setSign(ExpressionNode::Sign s, ExpressionNode::ReductionContext reductionContext) {
@@ -336,6 +380,19 @@ Expression Multiplication::shallowReduce(ExpressionNode::ReductionContext reduct
   return privateShallowReduce(reductionContext, true, true);
 }
 
+bool Multiplication::derivate(ExpressionNode::ReductionContext reductionContext, const Symbol & symbol) {
+  // (f×g×h)' = f'×g×h + f×g'×h + f×g×h'
+  Addition result = Addition::Builder();
+  int n = numberOfChildren();
+  for (int i = 0; i < n; i++) {
+    Expression term = clone();
+    term.replaceChildAtIndexInPlace(i, Derivative::Builder(childAtIndex(i).clone(), symbol.clone().convert<Symbol>(), symbol.clone()));
+    result.addChildAtIndexInPlace(term, i, i);
+  }
+  replaceWithInPlace(result);
+  return true;
+}
+
 static bool CanSimplifyUnitProduct(
     const Unit::Dimension::Vector<Integer> &unitsExponents, Unit::Dimension::Vector<Integer>::Metrics &unitsMetrics,
     const Unit::Dimension::Vector<int8_t> *entryUnitExponents, int8_t entryUnitNorm, int8_t entryUnitExponent,
@@ -11,6 +11,14 @@ constexpr Expression::FunctionHelper NaperianLogarithm::s_functionHelper;
 
 int NaperianLogarithmNode::numberOfChildren() const { return NaperianLogarithm::s_functionHelper.numberOfChildren(); }
 
+Enclosure NaperianLogarithmNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Logarithm(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit));
+}
+
+DualNumber NaperianLogarithmNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Logarithm(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit));
+}
+
 Layout NaperianLogarithmNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Prefix(this, floatDisplayMode, numberOfSignificantDigits, NaperianLogarithm::s_functionHelper.name());
 }
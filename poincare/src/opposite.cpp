@@ -43,6 +43,14 @@ bool OppositeNode::childAtIndexNeedsUserParentheses(const Expression & child, in
   return child.isOfType(types, 3);
 }
 
+Enclosure OppositeNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Scale(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit), -1.0);
+}
+
+DualNumber OppositeNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Scale(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit), -1.0);
+}
+
 Layout OppositeNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   HorizontalLayout result = HorizontalLayout::Builder(CodePointLayout::Builder('-'));
   if (childAtIndex(0)->type() == Type::Opposite) {
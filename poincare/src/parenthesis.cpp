@@ -8,6 +8,14 @@ int ParenthesisNode::polynomialDegree(Context * context, const char * symbolName
   return childAtIndex(0)->polynomialDegree(context, symbolName);
 }
 
+Enclosure ParenthesisNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit);
+}
+
+DualNumber ParenthesisNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit);
+}
+
 Layout ParenthesisNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Parentheses(childAtIndex(0)->createLayout(floatDisplayMode, numberOfSignificantDigits), false);
 }
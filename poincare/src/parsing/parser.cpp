@@ -6,6 +6,8 @@
 namespace Poincare {
 
 constexpr const Expression::FunctionHelper * Parser::s_reservedFunctions[];
+constexpr const char * Parser::s_specialIdentifierNames[];
+constexpr Parser::ReservedNamesTable Parser::s_reservedNamesTable = Parser::BuildReservedNamesTable(Parser::MakeSlotSequence<Parser::k_reservedNamesTableSize>::Type());
 
 Expression Parser::parse() {
   Expression result = parseUntil(Token::EndOfStream);
@@ -23,32 +25,23 @@ bool Parser::IsReservedName(const char * name, size_t nameLength) {
 
 // Private
 
-const Expression::FunctionHelper * const * Parser::GetReservedFunction(const char * name, size_t nameLength) {
-  const Expression::FunctionHelper * const * reservedFunction = s_reservedFunctions;
-  while (reservedFunction < s_reservedFunctionsUpperBound) {
-    int nameDifference = Token::CompareNonNullTerminatedName(name, nameLength, (**reservedFunction).name());
-    if (nameDifference == 0) {
-      return reservedFunction;
-    }
-    if (nameDifference < 0) {
-      break;
-    }
-    reservedFunction++;
+int Parser::ReservedNameIndex(const char * name, size_t nameLength) {
+  static_assert(ReservedNamesHashIsPerfect(), "Reserved names collide in the reserved names table, change k_reservedNamesHashSeed");
+  int index = s_reservedNamesTable.indexAtSlot[SlotOfName(name, nameLength)];
+  if (index < 0 || Token::CompareNonNullTerminatedName(name, nameLength, ReservedName(index)) != 0) {
+    return -1;
   }
-  return nullptr;
+  return index;
+}
+
+const Expression::FunctionHelper * const * Parser::GetReservedFunction(const char * name, size_t nameLength) {
+  int index = ReservedNameIndex(name, nameLength);
+  return index >= 0 && index < k_numberOfReservedFunctions ? s_reservedFunctions + index : nullptr;
 }
 
 bool Parser::IsSpecialIdentifierName(const char * name, size_t nameLength) {
   // TODO Avoid special cases if possible
-  return (
-    Token::CompareNonNullTerminatedName(name, nameLength, Symbol::k_ans)     == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Infinity::Name())  == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Undefined::Name()) == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Unreal::Name())    == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "u")               == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "v")               == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "w")               == 0
-  );
+  return ReservedNameIndex(name, nameLength) >= k_numberOfReservedFunctions;
 }
 
 Expression Parser::parseUntil(Token::Type stoppingType) {
@@ -461,7 +454,7 @@ void Parser::parseCustomIdentifier(Expression & leftHandSide, const char * name,
 
   Context::SymbolAbstractType idType = Context::SymbolAbstractType::None;
   if (m_context != nullptr && !m_symbolPlusParenthesesAreFunctions) {
-    idType = m_context->expressionTypeForIdentifier(name, length);
+    idType = expressionTypeForIdentifier(name, length);
     if (idType != Context::SymbolAbstractType::Function) {
       leftHandSide = Symbol::Builder(name, length);
       return;
@@ -500,6 +493,21 @@ void Parser::parseCustomIdentifier(Expression & leftHandSide, const char * name,
   }
 }
 
+Context::SymbolAbstractType Parser::expressionTypeForIdentifier(const char * name, size_t length) {
+  assert(m_context != nullptr);
+  int numberOfEntries = std::min(m_numberOfMemoizedIdentifierTypes, k_numberOfMemoizedIdentifierTypes);
+  for (int i = 0; i < numberOfEntries; i++) {
+    const IdentifierType & entry = m_memoizedIdentifierTypes[i];
+    if (entry.length == length && strncmp(entry.name, name, length) == 0) {
+      return entry.type;
+    }
+  }
+  Context::SymbolAbstractType type = m_context->expressionTypeForIdentifier(name, length);
+  m_memoizedIdentifierTypes[m_numberOfMemoizedIdentifierTypes % k_numberOfMemoizedIdentifierTypes] = {name, length, type};
+  m_numberOfMemoizedIdentifierTypes++;
+  return type;
+}
+
 void Parser::parseIdentifier(Expression & leftHandSide, Token::Type stoppingType) {
   assert(leftHandSide.isUninitialized());
   const Expression::FunctionHelper * const * functionHelper = GetReservedFunction(m_currentToken.text(), m_currentToken.length());
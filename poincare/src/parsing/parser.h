@@ -27,7 +27,8 @@ public:
     m_currentToken(Token(Token::Undefined)),
     m_nextToken(m_tokenizer.popToken()),
     m_pendingImplicitMultiplication(false),
-    m_symbolPlusParenthesesAreFunctions(false) {}
+    m_symbolPlusParenthesesAreFunctions(false),
+    m_numberOfMemoizedIdentifierTypes(0) {}
 
   Expression parse();
   Status getStatus() const { return m_status; }
@@ -37,6 +38,8 @@ public:
 private:
   static const Expression::FunctionHelper * const * GetReservedFunction(const char * name, size_t nameLength);
   static bool IsSpecialIdentifierName(const char * name, size_t nameLength);
+  // Index of name in the reserved names, or -1
+  static int ReservedNameIndex(const char * name, size_t nameLength);
 
   Expression parseUntil(Token::Type stoppingType);
 
@@ -78,6 +81,7 @@ private:
   void parseSequence(Expression & leftHandSide, const char name, Token::Type leftDelimiter1, Token::Type rightDelimiter1, Token::Type leftDelimiter2, Token::Type rightDelimiter2);
   void parseCustomIdentifier(Expression & leftHandSide, const char * name, size_t length);
   void defaultParseLeftParenthesis(bool isSystemParenthesis, Expression & leftHandSide, Token::Type stoppingType);
+  Context::SymbolAbstractType expressionTypeForIdentifier(const char * name, size_t length);
 
   // Data members
   Context * m_context;
@@ -90,6 +94,18 @@ private:
   Token m_nextToken;
   bool m_pendingImplicitMultiplication;
   bool m_symbolPlusParenthesesAreFunctions;
+  /* Context::expressionTypeForIdentifier looks identifiers up in the storage.
+   * The types of the last custom identifiers of the text are memoized, as the
+   * same variables are often used several times in an expression. The names
+   * point into the parsed text. */
+  struct IdentifierType {
+    const char * name;
+    size_t length;
+    Context::SymbolAbstractType type;
+  };
+  constexpr static int k_numberOfMemoizedIdentifierTypes = 4;
+  IdentifierType m_memoizedIdentifierTypes[k_numberOfMemoizedIdentifierTypes];
+  int m_numberOfMemoizedIdentifierTypes;
 
   // The array of reserved functions' helpers
   static constexpr const Expression::FunctionHelper * s_reservedFunctions[] = {
@@ -152,10 +168,69 @@ private:
     &SquareRoot::s_functionHelper
   };
   static constexpr const Expression::FunctionHelper * const * s_reservedFunctionsUpperBound = s_reservedFunctions + (sizeof(s_reservedFunctions)/sizeof(Expression::FunctionHelper *));
-  /* The method GetReservedFunction passes through the successive
-   * entries of the above array in order to determine whether m_currentToken
-   * corresponds to an entry. As a helper, the static constexpr
-   * s_reservedFunctionsUpperBound marks the end of the array. */
+  /* As a helper, the static constexpr s_reservedFunctionsUpperBound marks the
+   * end of the array: parseReservedFunction passes through the successive
+   * entries with the same name to match the number of parameters. */
+  static constexpr int k_numberOfReservedFunctions = sizeof(s_reservedFunctions)/sizeof(Expression::FunctionHelper *);
+
+  static constexpr const char * s_specialIdentifierNames[] = {
+    Symbol::k_ans,
+    Infinity::Name(),
+    Undefined::Name(),
+    Unreal::Name(),
+    "u",
+    "v",
+    "w"
+  };
+  static constexpr int k_numberOfReservedNames = k_numberOfReservedFunctions + sizeof(s_specialIdentifierNames)/sizeof(const char *);
+
+  /* Reserved names are the names of the reserved functions followed by the
+   * special identifiers. They are looked up in a perfect hash table built at
+   * compile time: each distinct name hashes to its own slot, so that an
+   * identifier is resolved with one hash and one string comparison. The hash
+   * is a FNV-1a whose seed was chosen so that the names do not collide. If a
+   * new name collides, the static_assert in ReservedNameIndex fails and the
+   * seed has to be changed. */
+  static constexpr int k_reservedNamesTableSizeLog2 = 8;
+  static constexpr int k_reservedNamesTableSize = 1 << k_reservedNamesTableSizeLog2;
+  static constexpr uint32_t k_reservedNamesHashSeed = 2166139721u;
+  static_assert(k_numberOfReservedNames <= INT8_MAX, "Reserved names indexes do not fit in the reserved names table");
+  static constexpr const char * ReservedName(int index) {
+    return index < k_numberOfReservedFunctions ? s_reservedFunctions[index]->name() : s_specialIdentifierNames[index - k_numberOfReservedFunctions];
+  }
+  static constexpr size_t NameLength(const char * name) {
+    return *name == 0 ? 0 : 1 + NameLength(name + 1);
+  }
+  static constexpr bool NamesAreEqual(const char * name1, const char * name2) {
+    return *name1 == *name2 && (*name1 == 0 || NamesAreEqual(name1 + 1, name2 + 1));
+  }
+  static constexpr uint32_t HashName(const char * name, size_t nameLength, uint32_t hash = k_reservedNamesHashSeed) {
+    return nameLength == 0 ? hash : HashName(name + 1, nameLength - 1, (hash ^ static_cast<uint8_t>(*name)) * 16777619u);
+  }
+  static constexpr int SlotOfName(const char * name, size_t nameLength) {
+    return HashName(name, nameLength) >> (32 - k_reservedNamesTableSizeLog2);
+  }
+  static constexpr int SlotOfReservedName(int index) {
+    return SlotOfName(ReservedName(index), NameLength(ReservedName(index)));
+  }
+  // The first reserved name hashed to slot, so that overloads start at "log"
+  static constexpr int ReservedNameIndexAtSlot(int slot, int index = 0) {
+    return index == k_numberOfReservedNames ? -1 : (SlotOfReservedName(index) == slot ? index : ReservedNameIndexAtSlot(slot, index + 1));
+  }
+  static constexpr bool ReservedNamesHashIsPerfect(int index = 0) {
+    return index == k_numberOfReservedNames
+      || (NamesAreEqual(ReservedName(ReservedNameIndexAtSlot(SlotOfReservedName(index))), ReservedName(index)) && ReservedNamesHashIsPerfect(index + 1));
+  }
+  struct ReservedNamesTable {
+    int8_t indexAtSlot[k_reservedNamesTableSize];
+  };
+  template<int... Slots> struct SlotSequence {};
+  template<int N, int... Slots> struct MakeSlotSequence : MakeSlotSequence<N - 1, N - 1, Slots...> {};
+  template<int... Slots> struct MakeSlotSequence<0, Slots...> { typedef SlotSequence<Slots...> Type; };
+  template<int... Slots> static constexpr ReservedNamesTable BuildReservedNamesTable(SlotSequence<Slots...>) {
+    return ReservedNamesTable{{static_cast<int8_t>(ReservedNameIndexAtSlot(Slots))...}};
+  }
+  static const ReservedNamesTable s_reservedNamesTable;
 };
 
 }
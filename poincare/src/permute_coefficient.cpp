@@ -1,4 +1,5 @@
 #include <poincare/permute_coefficient.h>
+#include <poincare/arithmetic.h>
 #include <poincare/undefined.h>
 #include <poincare/rational.h>
 #include <poincare/layout_helper.h>
@@ -88,18 +89,11 @@ Expression PermuteCoefficient::shallowReduce(Context * context) {
     replaceWithInPlace(result);
     return result;
   }
-  /* if n is too big, we do not reduce to avoid too long computation.
-   * The permute coefficient will be evaluate approximatively later */
-  if (Integer(k_maxNValue).isLowerThan(n)) {
+  Integer result = Arithmetic::PermuteCoefficient(n, k);
+  if (result.isOverflow()) {
+    // The permute coefficient will be approximated
     return *this;
   }
-  Integer result(1);
-  int clippedK = k.extractedInt(); // Authorized because k < n < k_maxNValue
-  for (int i = 0; i < clippedK; i++) {
-    Integer factor = Integer::Subtraction(n, Integer(i));
-    result = Integer::Multiplication(result, factor);
-  }
-  assert(!result.isOverflow()); // < permute(k_maxNValue, k_maxNValue-1)~10^158
   Expression rationalResult = Rational::Builder(result);
   replaceWithInPlace(rationalResult);
   return rationalResult;
@@ -4,11 +4,13 @@
 #include <poincare/binomial_coefficient.h>
 #include <poincare/constant.h>
 #include <poincare/cosine.h>
+#include <poincare/derivative.h>
 #include <poincare/division.h>
 #include <poincare/float.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/infinity.h>
 #include <poincare/matrix.h>
+#include <poincare/matrix_array.h>
 #include <poincare/matrix_identity.h>
 #include <poincare/matrix_inverse.h>
 #include <poincare/naperian_logarithm.h>
@@ -188,6 +190,14 @@ Complex<T> PowerNode::compute(const std::complex<T> c, const std::complex<T> d,
 
 // Layout
 
+Enclosure PowerNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Power(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit), childAtIndex(1)->enclosure(x, context, complexFormat, angleUnit));
+}
+
+DualNumber PowerNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Power(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit), childAtIndex(1)->dualNumber(x, context, complexFormat, angleUnit));
+}
+
 Layout PowerNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   ExpressionNode * indiceOperand = childAtIndex(1);
   HorizontalLayout result = HorizontalLayout::Builder();
@@ -224,6 +234,10 @@ Expression PowerNode::shallowReduce(ReductionContext reductionContext) {
   return Power(this).shallowReduce(reductionContext);
 }
 
+bool PowerNode::didDerivate(ReductionContext reductionContext, const Symbol & symbol) {
+  return Power(this).derivate(reductionContext, symbol);
+}
+
 Expression PowerNode::shallowBeautify(ReductionContext reductionContext) {
   return Power(this).shallowBeautify(reductionContext);
 }
@@ -261,7 +275,7 @@ template<typename T> MatrixComplex<T> PowerNode::computeOnMatrixAndComplex(const
     return MatrixComplex<T>::Undefined();
   }
   T power = Complex<T>::Builder(d).toScalar();
-  if (std::isnan(power) || std::isinf(power) || power != (int)power || std::fabs(power) > k_maxApproximatePowerMatrix) {
+  if (std::isnan(power) || std::isinf(power) || std::fabs(power) > k_maxApproximatePowerMatrix || power != (int)power) {
     return MatrixComplex<T>::Undefined();
   }
   if (power < 0) {
@@ -273,13 +287,37 @@ template<typename T> MatrixComplex<T> PowerNode::computeOnMatrixAndComplex(const
     MatrixComplex<T> result = PowerNode::computeOnMatrixAndComplex(inverse, minusC.stdComplex(), complexFormat);
     return result;
   }
-  MatrixComplex<T> result = MatrixComplex<T>::CreateIdentity(m.numberOfRows());
-  // TODO: implement a quick exponentiation
-  for (int k = 0; k < (int)power; k++) {
+  int dim = m.numberOfRows();
+  uint32_t exponent = static_cast<uint32_t>(power);
+  if (3*dim*dim <= Matrix::k_maxNumberOfCoefficients) {
+    return MatrixArray::WithBuffer<MatrixComplex<T>, std::complex<T>>(3*dim*dim,
+        [](std::complex<T> * operands, const void * matrix, const void * exponent) -> MatrixComplex<T> {
+          const MatrixComplex<T> * m = static_cast<const MatrixComplex<T> *>(matrix);
+          int dim = m->numberOfRows();
+          // Base, result and scratch buffers of the exponentiation by squaring
+          std::complex<T> * base = operands;
+          std::complex<T> * result = base + dim*dim;
+          m->copyOperands(base);
+          if (!MatrixArray::Power(base, result, result + dim*dim, dim, *static_cast<const uint32_t *>(exponent))) {
+            return MatrixComplex<T>::Undefined();
+          }
+          return MatrixComplex<T>::Builder(result, dim, dim);
+        }, &m, &exponent);
+  }
+  // Larger matrices are squared in the pool
+  MatrixComplex<T> result = MatrixComplex<T>::CreateIdentity(dim);
+  MatrixComplex<T> base = m;
+  while (exponent > 0) {
     if (Expression::ShouldStopProcessing()) {
       return MatrixComplex<T>::Undefined();
     }
-    result = MultiplicationNode::computeOnMatrices<T>(result, m, complexFormat);
+    if (exponent & 1) {
+      result = MultiplicationNode::computeOnMatrices<T>(result, base, complexFormat);
+    }
+    exponent >>= 1;
+    if (exponent > 0) {
+      base = MultiplicationNode::computeOnMatrices<T>(base, base, complexFormat);
+    }
   }
   return result;
 }
@@ -464,11 +502,18 @@ Expression Power::shallowReduce(ExpressionNode::ReductionContext reductionContex
         replaceWithInPlace(matrixBase);
         return std::move(matrixBase);
       }
-      Expression result = matrixBase.clone();
-      // TODO: implement a quick exponentiation
-      for (int k = 1; k < exp; k++) {
-        result = Multiplication::Builder(result, matrixBase.clone());
-        result = result.shallowReduce(reductionContext);
+      // Exponentiation by squaring
+      Expression result;
+      Expression square = matrixBase.clone();
+      while (true) {
+        if (exp & 1) {
+          result = result.isUninitialized() ? square.clone() : Multiplication::Builder(result, square.clone()).shallowReduce(reductionContext);
+        }
+        exp >>= 1;
+        if (exp == 0) {
+          break;
+        }
+        square = Multiplication::Builder(square, square.clone()).shallowReduce(reductionContext);
       }
       assert(!result.isUninitialized());
       replaceWithInPlace(result);
@@ -980,6 +1025,26 @@ Expression Power::shallowReduce(ExpressionNode::ReductionContext reductionContex
   return *this;
 }
 
+bool Power::derivate(ExpressionNode::ReductionContext reductionContext, const Symbol & symbol) {
+  Expression base = childAtIndex(0);
+  Expression exponent = childAtIndex(1);
+  if (exponent.polynomialDegree(reductionContext.context(), symbol.name()) == 0) {
+    // (f^n)' = n×f^(n-1)×f'
+    Expression exponentMinusOne = Addition::Builder(exponent.clone(), Rational::Builder(-1));
+    replaceWithInPlace(Multiplication::Builder(exponent.clone(), Power::Builder(base.clone(), exponentMinusOne), Derivative::Builder(base.clone(), symbol.clone().convert<Symbol>(), symbol.clone())));
+    return true;
+  }
+  /* (f^g)' = f^g×(g'×ln(f)+g×f'/f). In real mode, ln(f) is only defined for a
+   * positive f, whereas f^g can also be for integer values of g. */
+  if (reductionContext.complexFormat() == Preferences::ComplexFormat::Real && base.sign(reductionContext.context()) != ExpressionNode::Sign::Positive) {
+    return false;
+  }
+  Expression exponentTerm = Multiplication::Builder(Derivative::Builder(exponent.clone(), symbol.clone().convert<Symbol>(), symbol.clone()), NaperianLogarithm::Builder(base.clone()));
+  Expression baseTerm = Multiplication::Builder(exponent.clone(), Derivative::Builder(base.clone(), symbol.clone().convert<Symbol>(), symbol.clone()), Power::Builder(base.clone(), Rational::Builder(-1)));
+  replaceWithInPlace(Multiplication::Builder(clone(), Addition::Builder(exponentTerm, baseTerm)));
+  return true;
+}
+
 Expression Power::shallowBeautify(ExpressionNode::ReductionContext reductionContext) {
   // Step 1: X^-y -> 1/(X->shallowBeautify)^y
   Expression p = denominator(reductionContext);
@@ -0,0 +1,101 @@
+#include <poincare/reduction_memo.h>
+#include <poincare/based_integer.h>
+#include <poincare/rational.h>
+#include <poincare/symbol_abstract.h>
+#include <poincare/tree_pool.h>
+#include <assert.h>
+#include <string.h>
+
+namespace Poincare {
+
+// FNV-1a
+static uint32_t CombineHash(uint32_t hash, uint32_t value) {
+  return (hash ^ value) * 16777619u;
+}
+
+bool ReductionMemo::Hash(const Expression e, uint32_t * hash) {
+  *hash = 2166136261u;
+  int numberOfNodes = 0;
+  return HashSubtree(e, hash, &numberOfNodes);
+}
+
+bool ReductionMemo::HashSubtree(const Expression e, uint32_t * hash, int * numberOfNodes) {
+  if (++(*numberOfNodes) > k_maxNumberOfNodes) {
+    return false;
+  }
+  ExpressionNode::Type type = e.type();
+  /* isIdenticalTo does not compare the dimensions of matrices and the sign of
+   * infinities. It does not compare the base of integers either, but it does
+   * not change their reduction. */
+  if (type == ExpressionNode::Type::Matrix || type == ExpressionNode::Type::Infinity || e.isRandom()) {
+    return false;
+  }
+  int numberOfChildren = e.numberOfChildren();
+  *hash = CombineHash(*hash, static_cast<uint32_t>(type));
+  *hash = CombineHash(*hash, numberOfChildren);
+  if (type == ExpressionNode::Type::Rational || type == ExpressionNode::Type::BasedInteger) {
+    float value = type == ExpressionNode::Type::Rational ? static_cast<const Rational &>(e).node()->templatedApproximate<float>() : static_cast<const BasedInteger &>(e).node()->templatedApproximate<float>();
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    *hash = CombineHash(*hash, bits);
+  } else if (type == ExpressionNode::Type::Symbol || type == ExpressionNode::Type::Function || type == ExpressionNode::Type::Constant) {
+    for (const char * c = static_cast<const SymbolAbstract &>(e).name(); *c != 0; c++) {
+      *hash = CombineHash(*hash, static_cast<uint8_t>(*c));
+    }
+  }
+  for (int i = 0; i < numberOfChildren; i++) {
+    if (!HashSubtree(e.childAtIndex(i), hash, numberOfNodes)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Expression ReductionMemo::reducedExpression(const Expression e, Key * key) const {
+  *key = Key();
+  /* Only the children of n-ary expressions are memoized: they are reduced
+   * independently of their position and of their siblings, whereas the
+   * reduction of the base of a power depends on the logarithm it may be in for
+   * instance. Leaves are reduced at once and are not memoized either. */
+  Expression parent = e.parent();
+  if (e.numberOfChildren() == 0 || parent.isUninitialized()) {
+    return Expression();
+  }
+  ExpressionNode::Type parentType = parent.type();
+  if (parentType != ExpressionNode::Type::Addition && parentType != ExpressionNode::Type::Multiplication && parentType != ExpressionNode::Type::Matrix) {
+    return Expression();
+  }
+  if (TreePool::sharedPool()->size() > k_maxPoolSize || !Hash(e, &key->m_hash)) {
+    return Expression();
+  }
+  // Symbols under a parametered expression may be its parameter
+  for (Expression ancestor = parent; !ancestor.isUninitialized(); ancestor = ancestor.parent()) {
+    if (ancestor.isParameteredExpression()) {
+      return Expression();
+    }
+  }
+  key->m_parentType = parentType;
+  key->m_isValid = true;
+  for (int i = 0; i < m_numberOfEntries; i++) {
+    const Entry & entry = m_entries[i];
+    if (entry.key.m_hash == key->m_hash
+        && entry.key.m_parentType == key->m_parentType
+        && entry.expression.isIdenticalTo(e))
+    {
+      return entry.reducedExpression.clone();
+    }
+  }
+  return Expression();
+}
+
+void ReductionMemo::storeReducedExpression(Key key, Expression expression, const Expression reducedExpression) {
+  assert(key.isValid());
+  Entry & entry = m_entries[m_nextEntry];
+  entry.key = key;
+  entry.expression = expression;
+  entry.reducedExpression = reducedExpression.clone();
+  m_nextEntry = (m_nextEntry + 1) % k_numberOfEntries;
+  m_numberOfEntries = m_numberOfEntries < k_numberOfEntries ? m_numberOfEntries + 1 : k_numberOfEntries;
+}
+
+}
@@ -6,6 +6,7 @@ extern "C" {
 #include <assert.h>
 #include <stdlib.h>
 }
+#include <algorithm>
 #include <cmath>
 
 namespace Poincare {
@@ -23,30 +24,140 @@ Expression SequenceNode::shallowReduce(ReductionContext reductionContext) {
   return Sequence(this).shallowReduce(reductionContext.context());
 }
 
+/* Neumaier's variant of Kahan summation: the rounding error of each addition
+ * is accumulated in compensation, which is added back to the sum at the end.
+ * Unlike Kahan's, it also holds when the term is larger than the sum. */
+template<typename T>
+static T CompensatedAddition(T sum, T term, T * compensation) {
+  T result = sum + term;
+  *compensation += std::fabs(sum) >= std::fabs(term) ? (sum - result) + term : (term - result) + sum;
+  return result;
+}
+
 template<typename T>
 Evaluation<T> SequenceNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
   Evaluation<T> aInput = childAtIndex(2)->approximate(T(), context, complexFormat, angleUnit);
   Evaluation<T> bInput = childAtIndex(3)->approximate(T(), context, complexFormat, angleUnit);
   T start = aInput.toScalar();
   T end = bInput.toScalar();
-  if (std::isnan(start) || std::isnan(end) || start != (int)start || end != (int)end || end - start > k_maxNumberOfSteps) {
+  if (std::isnan(start) || start != (int)start) {
+    return Complex<T>::Undefined();
+  }
+  if (std::isinf(end) && end > 0) {
+    std::complex<double> limit = approximateSeries(start, context, complexFormat, angleUnit);
+    return Complex<T>::Builder(std::complex<T>(limit.real(), limit.imag()));
+  }
+  if (std::isnan(end) || end != (int)end || end - start > k_maxNumberOfSteps) {
     return Complex<T>::Undefined();
   }
   VariableContext nContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), context);
   Evaluation<T> result = Complex<T>::Builder((T)emptySequenceValue());
+  /* Scalar terms of sums are added with a compensated summation, which keeps
+   * long sums accurate. */
+  bool isCompensated = type() == Type::Sum;
+  std::complex<T> compensation = 0.0;
   for (int i = (int)start; i <= (int)end; i++) {
     if (Expression::ShouldStopProcessing()) {
       return Complex<T>::Undefined();
     }
     nContext.setApproximationForVariable<T>((T)i);
-    result = evaluateWithNextTerm(T(), result, childAtIndex(0)->approximate(T(), &nContext, complexFormat, angleUnit), complexFormat);
+    Evaluation<T> term = childAtIndex(0)->approximate(T(), &nContext, complexFormat, angleUnit);
+    if (isCompensated && result.type() == EvaluationNode<T>::Type::Complex && term.type() == EvaluationNode<T>::Type::Complex) {
+      std::complex<T> sum = static_cast<Complex<T> &>(result).stdComplex();
+      std::complex<T> t = static_cast<Complex<T> &>(term).stdComplex();
+      T realCompensation = compensation.real();
+      T imagCompensation = compensation.imag();
+      sum = std::complex<T>(CompensatedAddition(sum.real(), t.real(), &realCompensation), CompensatedAddition(sum.imag(), t.imag(), &imagCompensation));
+      compensation = std::complex<T>(realCompensation, imagCompensation);
+      result = Complex<T>::Builder(sum);
+    } else {
+      if (compensation != std::complex<T>(0.0)) {
+        result = evaluateWithNextTerm(T(), result, Complex<T>::Builder(compensation), complexFormat);
+        compensation = 0.0;
+      }
+      result = evaluateWithNextTerm(T(), result, term, complexFormat);
+    }
     if (result.isUndefined()) {
       return Complex<T>::Undefined();
     }
   }
+  if (compensation != std::complex<T>(0.0)) {
+    result = evaluateWithNextTerm(T(), result, Complex<T>::Builder(compensation), complexFormat);
+  }
   return result;
 }
 
+std::complex<double> SequenceNode::approximateSeries(double start, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  /* The partial results s(n) are transformed with the remainder estimates
+   * ω(n) = (n+1)×(s(n)-s(n-1)), using the recurrence of Fessler, Ford and
+   * Smith: numerators[0]/denominators[0] is the estimate of the limit from
+   * all the partial results so far. The terms are evaluated in double
+   * precision, the transform being sensitive to rounding errors. */
+  std::complex<double> numerators[k_maxNumberOfAcceleratedTerms];
+  std::complex<double> denominators[k_maxNumberOfAcceleratedTerms];
+  VariableContext nContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), context);
+  std::complex<double> partialResult = emptySequenceValue();
+  std::complex<double> previousEstimate = NAN;
+  bool previousEstimateConverged = false;
+  double previousDifference = NAN;
+  double largestDifference = 0.0;
+  int n = 0;
+  int numberOfNegligibleTerms = 0;
+  for (double k = start; n < k_maxNumberOfAcceleratedTerms && numberOfNegligibleTerms < k_maxNumberOfAcceleratedTerms; k++) {
+    if (Expression::ShouldStopProcessing()) {
+      return NAN;
+    }
+    nContext.setApproximationForVariable<double>(k);
+    Evaluation<double> next = evaluateWithNextTerm(double(), Complex<double>::Builder(partialResult), childAtIndex(0)->approximate(double(), &nContext, complexFormat, angleUnit), complexFormat);
+    if (next.type() != EvaluationNode<double>::Type::Complex || next.isUndefined()) {
+      return NAN;
+    }
+    std::complex<double> previousResult = partialResult;
+    partialResult = static_cast<Complex<double> &>(next).stdComplex();
+    std::complex<double> difference = partialResult - previousResult;
+    if (std::abs(difference) <= Expression::Epsilon<double>() * std::abs(partialResult)) {
+      // The term does not change the result, nor estimate the remainder
+      numberOfNegligibleTerms++;
+      continue;
+    }
+    numberOfNegligibleTerms = 0;
+    /* The transform also returns finite values for some divergent series,
+     * such as sum(1,k,1,inf) or sum((-1)^k,k,0,inf). An estimate is only
+     * trusted if the terms decrease and if the partial result is close to it:
+     * the remainder is bounded by a multiple of the last term, which grows
+     * with the number of terms and as the ratio of the terms tends to 1. */
+    double absoluteDifference = std::abs(difference);
+    bool termsDecrease = absoluteDifference < previousDifference && absoluteDifference < largestDifference;
+    double termsRatio = absoluteDifference / previousDifference;
+    previousDifference = absoluteDifference;
+    largestDifference = std::max(largestDifference, absoluteDifference);
+    double factor = 1.0 / (n + 1);
+    denominators[n] = factor / ((n + 1.0) * difference);
+    numerators[n] = partialResult * denominators[n];
+    double ratio = n * factor;
+    for (int j = 1; j <= n; j++) {
+      double coefficient = (n - j + 1) * factor;
+      numerators[n-j] = numerators[n-j+1] - coefficient * numerators[n-j];
+      denominators[n-j] = denominators[n-j+1] - coefficient * denominators[n-j];
+      factor *= ratio;
+    }
+    n++;
+    std::complex<double> estimate = numerators[0] / denominators[0];
+    /* The transform eventually diverges because of cancellations: the
+     * estimate is kept once it is stable on two consecutive steps. */
+    bool estimateConverged = std::abs(estimate - previousEstimate) <= k_seriesRelativeTolerance * std::abs(estimate);
+    if (estimateConverged && previousEstimateConverged) {
+      double remainderBound = k_maxRemainderToTermRatio * absoluteDifference * std::max<double>(n, 1.0 / (1.0 - termsRatio));
+      bool remainderIsBounded = std::abs(estimate - partialResult) <= remainderBound;
+      return termsDecrease && remainderIsBounded ? estimate : NAN;
+    }
+    previousEstimateConverged = estimateConverged;
+    previousEstimate = estimate;
+  }
+  // All the last terms were negligible: the partial result is the limit
+  return numberOfNegligibleTerms == k_maxNumberOfAcceleratedTerms ? partialResult : NAN;
+}
+
 Expression Sequence::shallowReduce(Context * context) {
   {
     Expression e = Expression::defaultShallowReduce();
@@ -1,7 +1,10 @@
 #include <poincare/sine.h>
 #include <poincare/complex.h>
+#include <poincare/cosine.h>
 #include <poincare/layout_helper.h>
+#include <poincare/multiplication.h>
 #include <poincare/serialization_helper.h>
+#include <poincare/trigonometry.h>
 
 #include <cmath>
 
@@ -22,6 +25,14 @@ Complex<T> SineNode::computeOnComplex(const std::complex<T> c, Preferences::Comp
   return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput));
 }
 
+Enclosure SineNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Sine(Enclosure::Scale(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit), M_PI/Trigonometry::PiInAngleUnit(angleUnit)));
+}
+
+DualNumber SineNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Sine(DualNumber::Scale(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit), M_PI/Trigonometry::PiInAngleUnit(angleUnit)));
+}
+
 Layout SineNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Prefix(Sine(this), floatDisplayMode, numberOfSignificantDigits, Sine::s_functionHelper.name());
 }
@@ -34,6 +45,9 @@ Expression SineNode::shallowReduce(ReductionContext reductionContext) {
   return Sine(this).shallowReduce(reductionContext);
 }
 
+Expression SineNode::unaryFunctionDifferential(ReductionContext reductionContext) const {
+  return Sine(this).unaryFunctionDifferential(reductionContext);
+}
 
 Expression Sine::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
   {
@@ -46,4 +60,9 @@ Expression Sine::shallowReduce(ExpressionNode::ReductionContext reductionContext
   return Trigonometry::shallowReduceDirectFunction(*this, reductionContext);
 }
 
+Expression Sine::unaryFunctionDifferential(ExpressionNode::ReductionContext reductionContext) const {
+  // sin'(x) = cos(x), with x converted to radians
+  return Multiplication::Builder(Trigonometry::UnitConversionFactor(reductionContext.angleUnit(), Preferences::AngleUnit::Radian), Cosine::Builder(childAtIndex(0).clone()));
+}
+
 }
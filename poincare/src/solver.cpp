@@ -2,6 +2,7 @@
 #include <poincare/ieee754.h>
 #include <assert.h>
 #include <float.h>
+#include <algorithm>
 #include <cmath>
 
 namespace Poincare {
@@ -176,6 +177,99 @@ double Solver::BrentRoot(double ax, double bx, double precision, ValueAtAbscissa
 }
 
 
+double Solver::NewtonRoot(double ax, double bx, double precision, DualNumberAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+  if (ax > bx) {
+    return NewtonRoot(bx, ax, precision, evaluation, context, complexFormat, angleUnit, context1, context2, context3);
+  }
+  DualNumber fa = evaluation(ax, context, complexFormat, angleUnit, context1, context2, context3);
+  DualNumber fb = evaluation(bx, context, complexFormat, angleUnit, context1, context2, context3);
+  if (fa.isUndefined() || fb.isUndefined()) {
+    return NAN;
+  }
+  if (fa.value() == 0.0) {
+    return ax;
+  }
+  if (fb.value() == 0.0) {
+    return bx;
+  }
+  if ((fa.value() > 0.0) == (fb.value() > 0.0)) {
+    return NAN;
+  }
+  Coordinate2D<double> root = fa.value() < 0.0 ?
+    SafeguardedNewton(ax, bx, precision, 0, evaluation, context, complexFormat, angleUnit, context1, context2, context3) :
+    SafeguardedNewton(bx, ax, precision, 0, evaluation, context, complexFormat, angleUnit, context1, context2, context3);
+  /* Around a pole, such as 0 for 1/x, the function changes sign without
+   * vanishing: the steps converge to the pole, where the function is larger
+   * than on the bounds. */
+  if (std::isnan(root.x1()) || std::fabs(root.x2()) > std::fabs(fa.value()) || std::fabs(root.x2()) > std::fabs(fb.value())) {
+    return NAN;
+  }
+  return root.x1();
+}
+
+Coordinate2D<double> Solver::NewtonMinimum(double ax, double bx, DualNumberAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+  if (ax > bx) {
+    return NewtonMinimum(bx, ax, evaluation, context, complexFormat, angleUnit, context1, context2, context3);
+  }
+  DualNumber fa = evaluation(ax, context, complexFormat, angleUnit, context1, context2, context3);
+  DualNumber fb = evaluation(bx, context, complexFormat, angleUnit, context1, context2, context3);
+  if (!(fa.derivative() < 0.0 && fb.derivative() > 0.0)) {
+    return Coordinate2D<double>(NAN, NAN);
+  }
+  double precision = k_sqrtEps*k_sqrtEps*std::max(std::fabs(ax), std::fabs(bx))+1E-14;
+  Coordinate2D<double> minimum = SafeguardedNewton(ax, bx, precision, 1, evaluation, context, complexFormat, angleUnit, context1, context2, context3);
+  /* With several extrema in [ax, bx], the derivative may also vanish on a
+   * maximum. */
+  if (std::isnan(minimum.x1()) || minimum.x2() > fa.value() || minimum.x2() > fb.value()) {
+    return Coordinate2D<double>(NAN, NAN);
+  }
+  return minimum;
+}
+
+Coordinate2D<double> Solver::SafeguardedNewton(double low, double high, double precision, int order, DualNumberAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+  /* Bibliography: W. H. Press et al., Numerical Recipes, rtsafe. The bracket
+   * [low, high] is kept around the zero, and low and high are not ordered:
+   * the function is negative on low and positive on high. */
+  assert(order == 0 || order == 1);
+  double x = 0.5*(low+high);
+  double step = std::fabs(high-low);
+  double previousStep = step;
+  bool converged = false;
+  for (int i = 0; i < k_maxNumberOfNewtonSteps; i++) {
+    DualNumber d = evaluation(x, context, complexFormat, angleUnit, context1, context2, context3);
+    if (d.isUndefined()) {
+      return Coordinate2D<double>(NAN, NAN);
+    }
+    double g = order == 0 ? d.value() : d.derivative();
+    if (converged || g == 0.0) {
+      return Coordinate2D<double>(x, d.value());
+    }
+    double dg = order == 0 ? d.derivative() : d.secondDerivative();
+    if (g < 0.0) {
+      low = x;
+    } else {
+      high = x;
+    }
+    double newtonX = x - g/dg;
+    /* Bisect if the Newton step leaves the bracket or if it is not twice
+     * smaller than the step before last: the function is then too far from
+     * its tangent for Newton's method to converge quickly. */
+    bool newtonIsSafe = dg != 0.0
+      && (newtonX - low)*(newtonX - high) < 0.0
+      && std::fabs(2.0*g) <= std::fabs(previousStep*dg);
+    previousStep = step;
+    if (newtonIsSafe) {
+      step = std::fabs(newtonX - x);
+      x = newtonX;
+    } else {
+      step = 0.5*std::fabs(high - low);
+      x = 0.5*(low + high);
+    }
+    converged = step <= precision;
+  }
+  return Coordinate2D<double>(NAN, NAN);
+}
+
 Coordinate2D<double> Solver::IncreasingFunctionRoot(double ax, double bx, double resultPrecision, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3, double * resultEvaluation) {
   assert(ax < bx);
   double min = ax;
@@ -219,6 +313,214 @@ Coordinate2D<double> Solver::IncreasingFunctionRoot(double ax, double bx, double
   return Coordinate2D<double>(currentAbscissa, eval);
 }
 
+int Solver::PolynomialRoots(const std::complex<double> * coefficients, int degree, std::complex<double> * roots) {
+  assert(degree > 0 && degree <= k_maxPolynomialRootsDegree);
+  for (int k = 0; k <= degree; k++) {
+    if (!std::isfinite(coefficients[k].real()) || !std::isfinite(coefficients[k].imag())) {
+      return -1;
+    }
+  }
+  // Deflate the null roots, which are exact
+  int numberOfNullRoots = 0;
+  while (numberOfNullRoots < degree && coefficients[numberOfNullRoots] == 0.0) {
+    numberOfNullRoots++;
+  }
+  const std::complex<double> * c = coefficients + numberOfNullRoots;
+  int n = degree - numberOfNullRoots;
+  if (c[n] == 0.0) {
+    return -1;
+  }
+  std::complex<double> z[k_maxPolynomialRootsDegree];
+  bool converged[k_maxPolynomialRootsDegree];
+  /* Start from points spread on a circle whose radius is the geometric mean of
+   * the moduli of the roots. The angular offset breaks the symmetry with the
+   * real axis. */
+  double radius = std::pow(std::abs(c[0] / c[n]), 1.0 / n);
+  for (int i = 0; i < n; i++) {
+    z[i] = std::polar(radius, 2.0 * M_PI * i / n + 0.4);
+    converged[i] = false;
+  }
+  int numberOfConvergedRoots = 0;
+  for (int step = 0; step < k_maxNumberOfAberthSteps && numberOfConvergedRoots < n; step++) {
+    for (int i = 0; i < n; i++) {
+      if (converged[i]) {
+        continue;
+      }
+      std::complex<double> derivative;
+      double bound;
+      std::complex<double> value = PolynomialValue(c, n, z[i], &derivative, &bound);
+      if (std::abs(value) <= DBL_EPSILON * bound) {
+        // The value is lost in the rounding errors
+        converged[i] = true;
+        numberOfConvergedRoots++;
+        continue;
+      }
+      /* Aberth correction: Newton's step on p(z)/Π(z-zj), where the zj are the
+       * other approximations, which keeps the iterates apart. */
+      std::complex<double> repulsion = 0.0;
+      for (int j = 0; j < n; j++) {
+        if (j != i) {
+          repulsion += 1.0 / (z[i] - z[j]);
+        }
+      }
+      std::complex<double> correction = 1.0 / (derivative / value - repulsion);
+      if (!std::isfinite(correction.real()) || !std::isfinite(correction.imag())) {
+        return -1;
+      }
+      z[i] -= correction;
+      if (std::abs(correction) <= DBL_EPSILON * std::abs(z[i])) {
+        converged[i] = true;
+        numberOfConvergedRoots++;
+      }
+    }
+  }
+  if (numberOfConvergedRoots < n) {
+    return -1;
+  }
+
+  /* The disk of center z[i] and radius n|p(z[i])|/|an×Π(z[i]-z[j])| contains a
+   * root. Overlapping disks form a cluster around a multiple root, which is
+   * approximated by their center of mass. */
+  double radii[k_maxPolynomialRootsDegree];
+  int clusters[k_maxPolynomialRootsDegree];
+  for (int i = 0; i < n; i++) {
+    std::complex<double> derivative;
+    double bound;
+    std::complex<double> value = PolynomialValue(c, n, z[i], &derivative, &bound);
+    std::complex<double> product = c[n];
+    for (int j = 0; j < n; j++) {
+      if (j != i) {
+        product *= z[i] - z[j];
+      }
+    }
+    radii[i] = product == 0.0 ? 0.0 : n * (std::abs(value) + DBL_EPSILON * bound) / std::abs(product);
+    clusters[i] = i;
+  }
+  for (int i = 0; i < n; i++) {
+    for (int j = i + 1; j < n; j++) {
+      if (clusters[j] != clusters[i] && std::abs(z[i] - z[j]) <= radii[i] + radii[j]) {
+        int merged = clusters[j];
+        for (int k = 0; k < n; k++) {
+          if (clusters[k] == merged) {
+            clusters[k] = clusters[i];
+          }
+        }
+      }
+    }
+  }
+
+  bool isReal = true;
+  for (int k = 0; k <= n; k++) {
+    isReal = isReal && c[k].imag() == 0.0;
+  }
+  int numberOfRoots = 0;
+  if (numberOfNullRoots > 0) {
+    roots[numberOfRoots++] = 0.0;
+  }
+  for (int i = 0; i < n; i++) {
+    if (clusters[i] != i) {
+      continue;
+    }
+    int multiplicity = 0;
+    std::complex<double> root = 0.0;
+    for (int j = 0; j < n; j++) {
+      if (clusters[j] == i) {
+        root += z[j];
+        multiplicity++;
+      }
+    }
+    root /= multiplicity;
+    double clusterRadius = 0.0;
+    for (int j = 0; j < n; j++) {
+      if (clusters[j] == i) {
+        clusterRadius = std::max(clusterRadius, radii[j] + std::abs(z[j] - root));
+      }
+    }
+    /* Polish the root with Newton's method on the (multiplicity-1)-th
+     * derivative of the polynomial, of which it is a simple root. */
+    std::complex<double> d[k_maxPolynomialRootsDegree + 1];
+    int dDegree = n - multiplicity + 1;
+    for (int k = 0; k <= dDegree; k++) {
+      d[k] = c[k + multiplicity - 1];
+      for (int l = k + 1; l < k + multiplicity; l++) {
+        d[k] *= l;
+      }
+    }
+    for (int step = 0; step < k_numberOfPolishingSteps; step++) {
+      std::complex<double> derivative;
+      double bound;
+      std::complex<double> value = PolynomialValue(d, dDegree, root, &derivative, &bound);
+      std::complex<double> correction = value / derivative;
+      if (!std::isfinite(correction.real()) || !std::isfinite(correction.imag()) || std::abs(correction) > clusterRadius) {
+        break;
+      }
+      root -= correction;
+    }
+    /* The components that are lost in the uncertainty of the polished root
+     * are null, and a root of a real polynomial whose imaginary part is lost
+     * is real. The cluster radius is no bound here: it is the width of the
+     * cluster before polishing, which is large around multiple roots. */
+    std::complex<double> derivative;
+    double bound;
+    std::complex<double> value = PolynomialValue(d, dDegree, root, &derivative, &bound);
+    double uncertainty = (std::abs(value) + DBL_EPSILON * bound) / std::abs(derivative);
+    if (std::isfinite(uncertainty)) {
+      root = std::complex<double>(std::fabs(root.real()) <= uncertainty ? 0.0 : root.real(), isReal && std::fabs(root.imag()) <= uncertainty ? 0.0 : root.imag());
+    }
+    roots[numberOfRoots++] = root;
+  }
+
+  if (isReal) {
+    // The non-real roots of a real polynomial are pairs of conjugates
+    for (int i = 0; i < numberOfRoots; i++) {
+      if (roots[i].imag() <= 0.0) {
+        continue;
+      }
+      int conjugate = -1;
+      for (int j = 0; j < numberOfRoots; j++) {
+        if (roots[j].imag() < 0.0 && (conjugate < 0 || std::abs(roots[j] - std::conj(roots[i])) < std::abs(roots[conjugate] - std::conj(roots[i])))) {
+          conjugate = j;
+        }
+      }
+      if (conjugate >= 0) {
+        roots[i] = 0.5 * (roots[i] + std::conj(roots[conjugate]));
+        roots[conjugate] = std::conj(roots[i]);
+      }
+    }
+  }
+
+  /* Sort the roots by real and imaginary parts. Real parts which only differ
+   * by rounding errors are considered equal. */
+  for (int i = 1; i < numberOfRoots; i++) {
+    std::complex<double> root = roots[i];
+    int j = i - 1;
+    while (j >= 0) {
+      double realTolerance = 4.0 * DBL_EPSILON * std::max(std::fabs(roots[j].real()), std::fabs(root.real()));
+      if (roots[j].real() < root.real() - realTolerance || (roots[j].real() <= root.real() + realTolerance && roots[j].imag() <= root.imag())) {
+        break;
+      }
+      roots[j + 1] = roots[j];
+      j--;
+    }
+    roots[j + 1] = root;
+  }
+  return numberOfRoots;
+}
+
+std::complex<double> Solver::PolynomialValue(const std::complex<double> * coefficients, int degree, std::complex<double> z, std::complex<double> * derivative, double * bound) {
+  // Horner's scheme
+  std::complex<double> value = coefficients[degree];
+  *derivative = 0.0;
+  *bound = std::abs(coefficients[degree]);
+  double modulus = std::abs(z);
+  for (int k = degree - 1; k >= 0; k--) {
+    *derivative = *derivative * z + value;
+    value = value * z + coefficients[k];
+    *bound = *bound * modulus + std::abs(coefficients[k]);
+  }
+  return value;
+}
+
 template<typename T>
 T Solver::CumulativeDistributiveInverseForNDefinedFunction(T * probability, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
   T precision = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
@@ -19,6 +19,14 @@ constexpr Expression::FunctionHelper SquareRoot::s_functionHelper;
 
 int SquareRootNode::numberOfChildren() const { return SquareRoot::s_functionHelper.numberOfChildren(); }
 
+Enclosure SquareRootNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::SquareRoot(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit));
+}
+
+DualNumber SquareRootNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::SquareRoot(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit));
+}
+
 Layout SquareRootNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return NthRootLayout::Builder(childAtIndex(0)->createLayout(floatDisplayMode, numberOfSignificantDigits));
 }
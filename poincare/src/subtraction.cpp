@@ -38,6 +38,14 @@ bool SubtractionNode::childAtIndexNeedsUserParentheses(const Expression & child,
   return child.isOfType(types, 3);
 }
 
+Enclosure SubtractionNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return Enclosure::Add(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit), Enclosure::Scale(childAtIndex(1)->enclosure(x, context, complexFormat, angleUnit), -1.0));
+}
+
+DualNumber SubtractionNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Add(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit), DualNumber::Scale(childAtIndex(1)->dualNumber(x, context, complexFormat, angleUnit), -1.0));
+}
+
 Layout SubtractionNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Infix(Subtraction(this), floatDisplayMode, numberOfSignificantDigits, "-");
 }
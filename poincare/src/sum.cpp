@@ -1,5 +1,12 @@
 #include <poincare/sum.h>
 #include <poincare/addition.h>
+#include <poincare/arithmetic.h>
+#include <poincare/complex.h>
+#include <poincare/division.h>
+#include <poincare/multiplication.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
+#include <poincare/subtraction.h>
 #include <poincare/sum_layout.h>
 #include <poincare/layout_helper.h>
 #include <poincare/serialization_helper.h>
@@ -21,6 +28,10 @@ int SumNode::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMod
   return SerializationHelper::Prefix(this, buffer, bufferSize, floatDisplayMode, numberOfSignificantDigits, Sum::s_functionHelper.name());
 }
 
+Expression SumNode::shallowReduce(ReductionContext reductionContext) {
+  return Sum(this).shallowReduce(reductionContext);
+}
+
 template<typename T>
 Evaluation<T> SumNode::templatedApproximateWithNextTerm(Evaluation<T> a, Evaluation<T> b, Preferences::ComplexFormat complexFormat) const {
   if (a.type() == EvaluationNode<T>::Type::Complex && b.type() == EvaluationNode<T>::Type::Complex) {
@@ -50,4 +61,132 @@ Expression Sum::UntypedBuilder(Expression children) {
   return Builder(children.childAtIndex(0), children.childAtIndex(1).convert<Symbol>(), children.childAtIndex(2), children.childAtIndex(3));
 }
 
+Expression Sum::shallowReduce(ExpressionNode::ReductionContext reductionContext) {
+  Expression e = Sequence::shallowReduce(reductionContext.context());
+  if (e.type() != ExpressionNode::Type::Sum) {
+    return e;
+  }
+  Context * context = reductionContext.context();
+  Expression term = childAtIndex(0);
+  Expression lowerBound = childAtIndex(2);
+  Expression upperBound = childAtIndex(3);
+  if (lowerBound.type() != ExpressionNode::Type::Rational
+      || !static_cast<Rational &>(lowerBound).isInteger()
+      || term.deepIsMatrix(context)
+      || term.recursivelyMatches(Expression::IsRandom, context))
+  {
+    return *this;
+  }
+  Integer a = static_cast<Rational &>(lowerBound).signedIntegerNumerator();
+  if (upperBound.type() == ExpressionNode::Type::Infinity && upperBound.sign(context) == ExpressionNode::Sign::Positive) {
+    return geometricClosedForm(a, nullptr, reductionContext);
+  }
+  if (upperBound.type() != ExpressionNode::Type::Rational || !static_cast<Rational &>(upperBound).isInteger()) {
+    return *this;
+  }
+  Integer b = static_cast<Rational &>(upperBound).signedIntegerNumerator();
+  Integer numberOfTerms = Integer::Addition(Integer::Subtraction(b, a), Integer(1));
+  if (numberOfTerms.isNegative()) {
+    return *this;
+  }
+  int degree = term.polynomialDegree(context, childAtIndex(1).convert<Symbol>().name());
+  if (degree >= 0 && degree <= k_maxPolynomialClosedFormDegree) {
+    return polynomialClosedForm(a, numberOfTerms, degree, reductionContext);
+  }
+  return geometricClosedForm(a, &numberOfTerms, reductionContext);
+}
+
+Expression Sum::polynomialClosedForm(const Integer & lowerBound, const Integer & numberOfTerms, int degree, ExpressionNode::ReductionContext reductionContext) {
+  /* With Δ the forward difference, a polynomial P of degree d is such that
+   * P(a+m) = Σ binomial(m,j)×Δ^jP(a) for j ≤ d, so that
+   * sum(P(k),k,a,a+n-1) = Σ binomial(n,j+1)×Δ^jP(a). As
+   * Δ^jP(a) = Σ (-1)^(j-i)×binomial(j,i)×P(a+i) for i ≤ j, the sum is
+   * Σ w(i)×P(a+i) for i ≤ d with the rational weights
+   * w(i) = Σ (-1)^(j-i)×binomial(j,i)×binomial(n,j+1) for i ≤ j ≤ d. */
+  Addition result = Addition::Builder();
+  for (int i = 0; i <= degree; i++) {
+    Rational weight = Rational::Builder(0);
+    for (int j = i; j <= degree; j++) {
+      Rational w = Rational::Builder(Integer::Multiplication(Arithmetic::BinomialCoefficient(Integer(j), Integer(i)), Arithmetic::BinomialCoefficient(numberOfTerms, Integer(j + 1))));
+      weight = Rational::Addition(weight, (j - i) % 2 == 0 ? w : Rational::Multiplication(w, Rational::Builder(-1)));
+    }
+    if (weight.numeratorOrDenominatorIsInfinity()) {
+      return *this;
+    }
+    if (!weight.isZero()) {
+      result.addChildAtIndexInPlace(Multiplication::Builder(weight, termAt(Integer::Addition(lowerBound, Integer(i)))), result.numberOfChildren(), result.numberOfChildren());
+    }
+  }
+  if (result.numberOfChildren() == 0) {
+    // The sum is empty
+    Expression zero = Rational::Builder(0);
+    replaceWithInPlace(zero);
+    return zero;
+  }
+  replaceWithInPlace(result);
+  return result.deepReduce(reductionContext);
+}
+
+Expression Sum::geometricClosedForm(const Integer & lowerBound, const Integer * numberOfTerms, ExpressionNode::ReductionContext reductionContext) {
+  Context * context = reductionContext.context();
+  const char * symbolName = childAtIndex(1).convert<Symbol>().name();
+  /* The term is geometric if it is of the form c×Π r(i)^(α(i)×k+β(i)), where
+   * c, r(i), α(i) and β(i) do not depend on k. Its ratio is q = Π r(i)^α(i). */
+  Expression term = childAtIndex(0);
+  bool termIsMultiplication = term.type() == ExpressionNode::Type::Multiplication;
+  int numberOfFactors = termIsMultiplication ? term.numberOfChildren() : 1;
+  Multiplication ratio = Multiplication::Builder();
+  for (int i = 0; i < numberOfFactors; i++) {
+    Expression factor = termIsMultiplication ? term.childAtIndex(i) : term;
+    if (factor.polynomialDegree(context, symbolName) == 0) {
+      continue;
+    }
+    if (factor.type() != ExpressionNode::Type::Power || factor.childAtIndex(0).polynomialDegree(context, symbolName) != 0) {
+      return *this;
+    }
+    Expression coefficients[Expression::k_maxNumberOfPolynomialCoefficients];
+    if (factor.childAtIndex(1).getPolynomialReducedCoefficients(symbolName, coefficients, context, reductionContext.complexFormat(), reductionContext.angleUnit(), reductionContext.symbolicComputation()) != 1) {
+      return *this;
+    }
+    ratio.addChildAtIndexInPlace(Power::Builder(factor.childAtIndex(0).clone(), coefficients[1]), ratio.numberOfChildren(), ratio.numberOfChildren());
+  }
+  if (ratio.numberOfChildren() == 0) {
+    // The term is constant
+    return *this;
+  }
+  Expression q = ratio.deepReduce(reductionContext);
+  /* The closed form requires q ≠ 1, which can only be checked on a value. If
+   * q depends on other symbols, the sum is left as is. */
+  Evaluation<double> approximateRatio = q.approximateToEvaluation<double>(context, reductionContext.complexFormat(), reductionContext.angleUnit());
+  if (approximateRatio.type() != EvaluationNode<double>::Type::Complex) {
+    return *this;
+  }
+  std::complex<double> qValue = static_cast<Complex<double> &>(approximateRatio).stdComplex();
+  if (std::isnan(qValue.real()) || std::isnan(qValue.imag()) || qValue == 1.0) {
+    return *this;
+  }
+  Expression result;
+  if (numberOfTerms == nullptr) {
+    // sum(T(k),k,a,∞) = T(a)/(1-q) if |q| < 1
+    if (!(std::abs(qValue) < 1.0)) {
+      return *this;
+    }
+    result = Division::Builder(termAt(lowerBound), Subtraction::Builder(Rational::Builder(1), q));
+  } else {
+    // sum(T(k),k,a,a+n-1) = T(a)×(q^n-1)/(q-1)
+    result = Multiplication::Builder(
+        termAt(lowerBound),
+        Division::Builder(
+          Subtraction::Builder(Power::Builder(q.clone(), Rational::Builder(*numberOfTerms)), Rational::Builder(1)),
+          Subtraction::Builder(q, Rational::Builder(1))));
+  }
+  replaceWithInPlace(result);
+  return result.deepReduce(reductionContext);
+}
+
+Expression Sum::termAt(const Integer & index) const {
+  Expression term = childAtIndex(0).clone();
+  return term.replaceSymbolWithExpression(childAtIndex(1).convert<Symbol>(), Rational::Builder(index));
+}
+
 }
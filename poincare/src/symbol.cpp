@@ -68,6 +68,14 @@ float SymbolNode::characteristicXRange(Context * context, Preferences::AngleUnit
   return isUnknown() ? NAN : 0.0f;
 }
 
+Enclosure SymbolNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return isUnknown() ? x : ExpressionNode::enclosure(x, context, complexFormat, angleUnit);
+}
+
+DualNumber SymbolNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return isUnknown() ? x : ExpressionNode::dualNumber(x, context, complexFormat, angleUnit);
+}
+
 Layout SymbolNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   assert(!isUnknown());
   // TODO return Parse(m_name).createLayout() ?
@@ -94,6 +102,10 @@ Expression SymbolNode::shallowReduce(ReductionContext reductionContext) {
   return Symbol(this).shallowReduce(reductionContext);
 }
 
+bool SymbolNode::didDerivate(ReductionContext reductionContext, const Symbol & symbol) {
+  return Symbol(this).derivate(reductionContext, symbol);
+}
+
 Expression SymbolNode::deepReplaceReplaceableSymbols(Context * context, bool * didReplace, bool replaceFunctionsOnly, int parameteredAncestorsCount) {
   return Symbol(this).deepReplaceReplaceableSymbols(context, didReplace, replaceFunctionsOnly, parameteredAncestorsCount);
 }
@@ -110,6 +122,10 @@ ExpressionNode::LayoutShape SymbolNode::leftLayoutShape() const {
 template<typename T>
 Evaluation<T> SymbolNode::templatedApproximate(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
   Symbol s(this);
+  double value;
+  if (context->approximationForSymbol(s, complexFormat, angleUnit, sizeof(T) == sizeof(double), &value)) {
+    return Complex<T>::Builder(static_cast<T>(value));
+  }
   Expression e = SymbolAbstract::Expand(s, context, false);
   if (e.isUninitialized()) {
     return Complex<T>::Undefined();
@@ -192,6 +208,11 @@ Expression Symbol::shallowReduce(ExpressionNode::ReductionContext reductionConte
   return result.deepReduce(reductionContext);
 }
 
+bool Symbol::derivate(ExpressionNode::ReductionContext reductionContext, const Symbol & symbol) {
+  replaceWithInPlace(Rational::Builder(hasSameNameAs(symbol) ? 1 : 0));
+  return true;
+}
+
 Expression Symbol::replaceSymbolWithExpression(const SymbolAbstract & symbol, const Expression & expression) {
   if (symbol.type() == ExpressionNode::Type::Symbol && hasSameNameAs(symbol)) {
     Expression value = expression.clone();
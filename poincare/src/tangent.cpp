@@ -18,6 +18,15 @@ float TangentNode::characteristicXRange(Context * context, Preferences::AngleUni
   return Trigonometry::characteristicXRange(Tangent(this), context, angleUnit);
 }
 
+Enclosure TangentNode::enclosure(Enclosure x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  Enclosure angle = Enclosure::Scale(childAtIndex(0)->enclosure(x, context, complexFormat, angleUnit), M_PI/Trigonometry::PiInAngleUnit(angleUnit));
+  return Enclosure::Multiply(Enclosure::Sine(angle), Enclosure::Inverse(Enclosure::Cosine(angle)));
+}
+
+DualNumber TangentNode::dualNumber(DualNumber x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const {
+  return DualNumber::Tangent(DualNumber::Scale(childAtIndex(0)->dualNumber(x, context, complexFormat, angleUnit), M_PI/Trigonometry::PiInAngleUnit(angleUnit)));
+}
+
 Layout TangentNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return LayoutHelper::Prefix(Tangent(this), floatDisplayMode, numberOfSignificantDigits, Tangent::s_functionHelper.name());
 }
@@ -119,6 +119,9 @@ void * TreePool::alloc(size_t size) {
   }
   void * result = m_cursor;
   m_cursor += size;
+  if (this->size() > m_peakSize) {
+    m_peakSize = this->size();
+  }
   return result;
 }
 
@@ -53,6 +53,13 @@ double Trigonometry::PiInAngleUnit(Preferences::AngleUnit angleUnit) {
   return 200.0;
 }
 
+Expression Trigonometry::UnitConversionFactor(Preferences::AngleUnit fromUnit, Preferences::AngleUnit toUnit) {
+  if (fromUnit == toUnit) {
+    return Rational::Builder(1);
+  }
+  return Multiplication::Builder(piExpression(toUnit), Power::Builder(piExpression(fromUnit), Rational::Builder(-1)));
+}
+
 float Trigonometry::characteristicXRange(const Expression & e, Context * context, Preferences::AngleUnit angleUnit) {
   assert(e.numberOfChildren() == 1);
 
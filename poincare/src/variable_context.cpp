@@ -35,6 +35,13 @@ const Expression VariableContext::expressionForSymbolAbstract(const SymbolAbstra
   }
 }
 
+bool VariableContext::approximationForSymbol(const Symbol & symbol, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool doublePrecision, double * value) {
+  if (m_name != nullptr && strcmp(symbol.name(), m_name) == 0) {
+    return false;
+  }
+  return parentContext()->approximationForSymbol(symbol, complexFormat, angleUnit, doublePrecision, value);
+}
+
 template void VariableContext::setApproximationForVariable(float);
 template void VariableContext::setApproximationForVariable(double);
 
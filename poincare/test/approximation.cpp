@@ -341,6 +341,16 @@ QUIZ_CASE(poincare_approximation_function) {
 
   assert_expression_approximates_to<float>("sum(r,r, 4, 10)", "49");
   assert_expression_approximates_to<double>("sum(k,k, 4, 10)", "49");
+  assert_expression_approximates_to<float>("sum(0.1,k,1,10000)", "1000");
+  assert_expression_approximates_to<float>("sum(1/k^2,k,1,inf)", "1.644934");
+  assert_expression_approximates_to<double>("sum(1/k^2,k,1,inf)", "1.644934067", Radian, Cartesian, 10);
+  assert_expression_approximates_to<double>("sum((-1)^k/k,k,1,inf)", "-0.6931471806", Radian, Cartesian, 10);
+  assert_expression_approximates_to<double>("sum(1/k!,k,0,inf)", "2.718281828459");
+  assert_expression_approximates_to<double>("product(1-1/(4k^2),k,1,inf)", "0.6366197724", Radian, Cartesian, 10);
+  assert_expression_approximates_to<double>("sum(1/k,k,1,inf)", Undefined::Name());
+  assert_expression_approximates_to<double>("sum(1,k,1,inf)", Undefined::Name());
+  assert_expression_approximates_to<double>("sum((-1)^k,k,0,inf)", Undefined::Name());
+  assert_expression_approximates_to<double>("sum((-1)^k×k,k,1,inf)", Undefined::Name());
 
   assert_expression_approximates_to<float>("trace([[1,2,3][4,5,6][7,8,9]])", "15");
   assert_expression_approximates_to<double>("trace([[1,2,3][4,5,6][7,8,9]])", "15");
@@ -807,6 +817,18 @@ QUIZ_CASE(poincare_approximation_trigonometry_functions) {
 QUIZ_CASE(poincare_approximation_matrix) {
   assert_expression_approximates_to<float>("[[1,2,3][4,5,6]]", "[[1,2,3][4,5,6]]");
   assert_expression_approximates_to<double>("[[1,2,3][4,5,6]]", "[[1,2,3][4,5,6]]");
+  // Exponentiation by squaring
+  assert_expression_approximates_to<double>("[[0.9,0.1][0.5,0.5]]^10000", "[[0.8333333333,0.1666666667][0.8333333333,0.1666666667]]", Degree, Cartesian, 10);
+  assert_expression_approximates_to<float>("[[1,1][1,0]]^20", "[[10946,6765][6765,4181]]");
+  assert_expression_approximates_to<double>("[[1,1][1,0]]^(-2)", "[[1,-1][-1,2]]");
+  assert_expression_approximates_to<double>("trace(identity(11)^1000)", "11");
+  // Partial pivoting
+  assert_expression_approximates_to<double>("det([[0,1][1,0]])", "-1");
+  assert_expression_approximates_to<double>("det([[1,2][2,4]])", "0");
+  assert_expression_approximates_to<double>("inverse([[0,1,0][0,0,1][1,0,0]])", "[[0,0,1][1,0,0][0,1,0]]");
+  // Matrices larger than the former 10x10 cap
+  assert_expression_approximates_to<double>("det(2×identity(12))", "4096");
+  assert_expression_approximates_to<double>("trace(inverse(2×identity(12)))", "6");
 }
 
 QUIZ_CASE(poincare_approximation_store) {
@@ -968,3 +990,103 @@ QUIZ_CASE(poincare_approximation_mix) {
 template void assert_expression_approximates_to_scalar(const char * expression, float approximation, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat);
 template void assert_expression_approximates_to_scalar(const char * expression, double approximation, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat);
 
+
+void assert_expression_encloses_to(const char * expression, double xMin, double xMax, Enclosure::Decoration decoration, double lower = NAN, double upper = NAN, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  e = e.replaceSymbolWithExpression(Symbol::Builder('x'), Symbol::Builder(UCodePointUnknown));
+  Enclosure result = e.enclosure(Enclosure(xMin, xMax), &globalContext, Real, angleUnit);
+  quiz_assert_print_if_failure(result.decoration() == decoration, expression);
+  if (decoration == Enclosure::Decoration::Continuous) {
+    constexpr double precision = 1e-12;
+    quiz_assert_print_if_failure(std::fabs(result.lower() - lower) <= precision && std::fabs(result.upper() - upper) <= precision, expression);
+  }
+}
+
+QUIZ_CASE(poincare_approximation_enclosure) {
+  constexpr Enclosure::Decoration Continuous = Enclosure::Decoration::Continuous;
+  constexpr Enclosure::Decoration Discontinuous = Enclosure::Decoration::Discontinuous;
+  constexpr Enclosure::Decoration Unknown = Enclosure::Decoration::Unknown;
+  assert_expression_encloses_to("3", -1.0, 1.0, Continuous, 3.0, 3.0);
+  assert_expression_encloses_to("2x+1", -1.0, 1.0, Continuous, -1.0, 3.0);
+  assert_expression_encloses_to("x^2", -1.0, 2.0, Continuous, 0.0, 4.0);
+  assert_expression_encloses_to("x^3-x", 1.0, 2.0, Continuous, -1.0, 7.0);
+  assert_expression_encloses_to("1/x", 1.0, 2.0, Continuous, 0.5, 1.0);
+  assert_expression_encloses_to("1/x", -1.0, 1.0, Discontinuous);
+  assert_expression_encloses_to("ℯ^x", 0.0, 1.0, Continuous, 1.0, M_E);
+  assert_expression_encloses_to("ln(x)", 1.0, M_E, Continuous, 0.0, 1.0);
+  assert_expression_encloses_to("ln(x)", -1.0, 1.0, Unknown);
+  assert_expression_encloses_to("√(x)", 1.0, 4.0, Continuous, 1.0, 2.0);
+  assert_expression_encloses_to("abs(x)", -3.0, 2.0, Continuous, 0.0, 3.0);
+  assert_expression_encloses_to("sin(x)", 0.0, M_PI, Continuous, 0.0, 1.0);
+  assert_expression_encloses_to("cos(x)", -1.0, 1.0, Continuous, std::cos(1.0), 1.0);
+  assert_expression_encloses_to("cos(x)", 0.0, 7.0, Continuous, -1.0, 1.0);
+  assert_expression_encloses_to("sin(x)", 0.0, 90.0, Continuous, 0.0, 1.0, Degree);
+  assert_expression_encloses_to("tan(x)", 1.0, 2.0, Discontinuous);
+  assert_expression_encloses_to("atan(x)", -1.0, 1.0, Continuous, -M_PI/4.0, M_PI/4.0);
+  assert_expression_encloses_to("floor(x)", 0.2, 0.8, Continuous, 0.0, 0.0);
+  assert_expression_encloses_to("floor(x)", 0.8, 1.2, Discontinuous);
+  assert_expression_encloses_to("frac(x)", 1.2, 1.7, Continuous, 0.2, 0.7);
+  assert_expression_encloses_to("random()×x", 0.0, 1.0, Unknown);
+}
+
+void assert_expression_derivates_to(const char * expression, double x, double value = NAN, double derivative = NAN, double secondDerivative = NAN, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  e = e.replaceSymbolWithExpression(Symbol::Builder('x'), Symbol::Builder(UCodePointUnknown));
+  DualNumber result = e.dualNumber(DualNumber::Variable(x), &globalContext, Real, angleUnit);
+  if (std::isnan(value)) {
+    quiz_assert_print_if_failure(result.isUndefined(), expression);
+    return;
+  }
+  constexpr double precision = 1e-12;
+  quiz_assert_print_if_failure(
+      std::fabs(result.value() - value) <= precision &&
+      std::fabs(result.derivative() - derivative) <= precision &&
+      std::fabs(result.secondDerivative() - secondDerivative) <= precision,
+      expression);
+}
+
+QUIZ_CASE(poincare_approximation_dual_number) {
+  assert_expression_derivates_to("3", 1.0, 3.0, 0.0, 0.0);
+  assert_expression_derivates_to("x^2", 3.0, 9.0, 6.0, 2.0);
+  assert_expression_derivates_to("x^3-2x", 2.0, 4.0, 10.0, 12.0);
+  assert_expression_derivates_to("1/x", 2.0, 0.5, -0.25, 0.25);
+  assert_expression_derivates_to("1/x", 0.0);
+  assert_expression_derivates_to("ℯ^(2x)", 0.0, 1.0, 2.0, 4.0);
+  assert_expression_derivates_to("ln(x)", 2.0, std::log(2.0), 0.5, -0.25);
+  assert_expression_derivates_to("ln(x)", -1.0);
+  assert_expression_derivates_to("log(x)", 1.0, 0.0, 1.0/std::log(10.0), -1.0/std::log(10.0));
+  assert_expression_derivates_to("√(x)", 4.0, 2.0, 0.25, -1.0/32.0);
+  assert_expression_derivates_to("abs(x)", -2.0, 2.0, -1.0, 0.0);
+  assert_expression_derivates_to("abs(x)", 0.0);
+  assert_expression_derivates_to("sin(x)", 0.0, 0.0, 1.0, 0.0);
+  assert_expression_derivates_to("cos(x)", 90.0, 0.0, -M_PI/180.0, 0.0, Degree);
+  assert_expression_derivates_to("atan(x)", 0.0, 0.0, 1.0, 0.0);
+  assert_expression_derivates_to("x^x", 1.0, 1.0, 1.0, 2.0);
+  assert_expression_derivates_to("random()×x", 1.0);
+}
+
+void assert_expression_approximates_keeping_symbols_to(const char * expression, const char * result) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  e = e.approximateKeepingSymbols(&globalContext, Cartesian, Radian);
+  constexpr int bufferSize = 500;
+  char buffer[bufferSize];
+  e.serialize(buffer, bufferSize, DecimalMode, 7);
+  quiz_assert_print_if_failure(strcmp(buffer, result) == 0, expression);
+}
+
+QUIZ_CASE(poincare_approximation_keeping_symbols) {
+  assert_expression_approximates_keeping_symbols_to("3", "3");
+  assert_expression_approximates_keeping_symbols_to("2+3", "5");
+  assert_expression_approximates_keeping_symbols_to("x^3", "x^3");
+  assert_expression_approximates_keeping_symbols_to("2^(1/3)×x", "1.259921×x");
+  assert_expression_approximates_keeping_symbols_to("√(2)×π/ln(3)×x", "4.044086×x");
+  assert_expression_approximates_keeping_symbols_to("2+x+π+x^2", "5.141593+x+x^2");
+  assert_expression_approximates_keeping_symbols_to("[[1+1][x+cos(0)]]", "[[2][x+1]]");
+  assert_expression_approximates_keeping_symbols_to("random()×x+cos(0)", "random()×x+1");
+  assert_expression_approximates_keeping_symbols_to("sum(k×2^3,k,1,x)", "sum(k×8,k,1,x)");
+  assert_expression_approximates_keeping_symbols_to("x+√(-1)", "x+√(-1)");
+  assert_expression_approximates_keeping_symbols_to("2×𝐢×x", "2×𝐢×x");
+}
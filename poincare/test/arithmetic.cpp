@@ -50,6 +50,24 @@ void assert_prime_factorization_equals_to(Integer a, int * factors, int * coeffi
   }
 }
 
+void assert_binomial_coefficient_equals_to(Integer n, Integer k, Integer c) {
+  constexpr size_t bufferSize = 100;
+  char failInformationBuffer[bufferSize];
+  Integer args[2] = {n, k};
+  fill_buffer_with(failInformationBuffer, bufferSize, "binomial(", args, 2);
+  Integer binomial = Arithmetic::BinomialCoefficient(n, k);
+  quiz_assert_print_if_failure(binomial.isEqualTo(c), failInformationBuffer);
+}
+
+void assert_permute_coefficient_equals_to(Integer n, Integer k, Integer c) {
+  constexpr size_t bufferSize = 100;
+  char failInformationBuffer[bufferSize];
+  Integer args[2] = {n, k};
+  fill_buffer_with(failInformationBuffer, bufferSize, "permute(", args, 2);
+  Integer permute = Arithmetic::PermuteCoefficient(n, k);
+  quiz_assert_print_if_failure(permute.isEqualTo(c), failInformationBuffer);
+}
+
 QUIZ_CASE(poincare_arithmetic_gcd) {
   assert_gcd_equals_to(Integer(11), Integer(121), Integer(11));
   assert_gcd_equals_to(Integer(-256), Integer(321), Integer(1));
@@ -80,3 +98,23 @@ QUIZ_CASE(poincare_arithmetic_factorization) {
   int coefficients3[7] = {4,2,2,2,2,2,2};
   assert_prime_factorization_equals_to(Integer("5513219850886344455940081"), factors3, coefficients3, 7);
 }
+
+QUIZ_CASE(poincare_arithmetic_combinatorics) {
+  quiz_assert(Arithmetic::Factorial(Integer(0)).isEqualTo(Integer(1)));
+  quiz_assert(Arithmetic::Factorial(Integer(20)).isEqualTo(Integer("2432902008176640000")));
+  quiz_assert(Arithmetic::Factorial(Integer(170)).isEqualTo(Integer("7257415615307998967396728211129263114716991681296451376543577798900561843401706157852350749242617459511490991237838520776666022565442753025328900773207510902400430280058295603966612599658257104398558294257568966313439612262571094946806711205568880457193340212661452800000000000000000000000000000000000000000")));
+  quiz_assert(Arithmetic::Factorial(Integer(171)).isOverflow());
+  quiz_assert(Arithmetic::Factorial(Integer(100000)).isOverflow());
+  assert_binomial_coefficient_equals_to(Integer(10), Integer(0), Integer(1));
+  assert_binomial_coefficient_equals_to(Integer(10), Integer(4), Integer(210));
+  assert_binomial_coefficient_equals_to(Integer(4), Integer(10), Integer(0));
+  assert_binomial_coefficient_equals_to(Integer(1000), Integer(500), Integer("270288240945436569515614693625975275496152008446548287007392875106625428705522193898612483924502370165362606085021546104802209750050679917549894219699518475423665484263751733356162464079737887344364574161119497604571044985756287880514600994219426752366915856603136862602484428109296905863799821216320"));
+  assert_binomial_coefficient_equals_to(Integer(1000000), Integer(3), Integer("166666166667000000"));
+  assert_binomial_coefficient_equals_to(Integer(1000000), Integer(999997), Integer("166666166667000000"));
+  quiz_assert(Arithmetic::BinomialCoefficient(Integer(2000), Integer(1000)).isOverflow());
+  assert_permute_coefficient_equals_to(Integer(10), Integer(4), Integer(5040));
+  assert_permute_coefficient_equals_to(Integer(10), Integer(0), Integer(1));
+  assert_permute_coefficient_equals_to(Integer(100), Integer(50), Integer("3068518756254966037202730459529469739228459721684688959447786986982158958772355072000000000000"));
+  assert_permute_coefficient_equals_to(Integer(8000), Integer(3), Integer("511808016000"));
+  quiz_assert(Arithmetic::PermuteCoefficient(Integer(1000000), Integer(100)).isOverflow());
+}
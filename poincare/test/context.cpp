@@ -223,5 +223,32 @@ QUIZ_CASE(poincare_context_user_variable_properties) {
   Ion::Storage::sharedStorage()->recordNamed("g.func").destroy();
 }
 
+QUIZ_CASE(poincare_context_memoized_approximation) {
+  Shared::GlobalContext context;
+  Expression a = Symbol::Builder('a');
+  Expression sum = Sum::Builder(Addition::Builder(a, Symbol::Builder('k')), Symbol::Builder('k'), Rational::Builder(1), Rational::Builder(2));
+
+  assert_parsed_expression_simplify_to("2→a", "2");
+  quiz_assert(a.approximateToScalar<double>(&context, Cartesian, Radian) == 2.0);
+  quiz_assert(a.approximateToScalar<float>(&context, Cartesian, Radian) == 2.0f);
+  quiz_assert(sum.approximateToScalar<double>(&context, Cartesian, Radian) == 7.0);
+
+  // The memoized approximations are outdated when the storage changes
+  assert_parsed_expression_simplify_to("5→a", "5");
+  quiz_assert(a.approximateToScalar<double>(&context, Cartesian, Radian) == 5.0);
+  quiz_assert(sum.approximateToScalar<double>(&context, Cartesian, Radian) == 13.0);
+  Ion::Storage::sharedStorage()->recordNamed("a.exp").destroy();
+  quiz_assert(std::isnan(a.approximateToScalar<double>(&context, Cartesian, Radian)));
+
+  // Symbols defined by a variable context are not memoized
+  assert_parsed_expression_simplify_to("k+1→b", "k+1");
+  Expression b = Sum::Builder(Symbol::Builder('b'), Symbol::Builder('k'), Rational::Builder(1), Rational::Builder(2));
+  quiz_assert(std::isnan(Symbol::Builder('b').approximateToScalar<double>(&context, Cartesian, Radian)));
+  quiz_assert(b.approximateToScalar<double>(&context, Cartesian, Radian) == 5.0);
+
+  // Clean the storage for other tests
+  Ion::Storage::sharedStorage()->recordNamed("b.exp").destroy();
+}
+
 template void assert_parsed_expression_approximates_with_value_for_symbol(Poincare::Expression, const char *, float, float, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit);
 template void assert_parsed_expression_approximates_with_value_for_symbol(Poincare::Expression, const char *, double, double, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit);
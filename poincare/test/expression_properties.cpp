@@ -216,9 +216,10 @@ QUIZ_CASE(poincare_properties_polynomial_degree) {
   assert_reduced_expression_polynomial_degree("x+1", 1);
   assert_reduced_expression_polynomial_degree("cos(2)+1", 0);
   assert_reduced_expression_polynomial_degree("confidence(0.2,10)+1", -1);
-  assert_reduced_expression_polynomial_degree("diff(3×x+x,x,2)", -1);
-  assert_reduced_expression_polynomial_degree("diff(3×x+x,x,x)", -1);
-  assert_reduced_expression_polynomial_degree("diff(3×x+x,x,x)", 0, "a");
+  assert_reduced_expression_polynomial_degree("diff(3×x+x,x,2)", 0);
+  assert_reduced_expression_polynomial_degree("diff(3×x^2+x,x,x)", 1);
+  assert_reduced_expression_polynomial_degree("diff(abs(x),x,x)", -1);
+  assert_reduced_expression_polynomial_degree("diff(abs(x),x,x)", 0, "a");
   assert_reduced_expression_polynomial_degree("(3×x+2)/3", 1);
   assert_reduced_expression_polynomial_degree("(3×x+2)/x", -1);
   assert_reduced_expression_polynomial_degree("int(2×x,x, 0, 1)", -1);
@@ -340,9 +341,8 @@ QUIZ_CASE(poincare_properties_get_polynomial_coefficients) {
   assert_reduced_expression_has_polynomial_coefficient("x^2+x+2", "x", coefficient0);
   const char * coefficient1[] = {"12+(-6)×π", "12", "3", 0}; //3×x^2+12×x-6×π+12
   assert_reduced_expression_has_polynomial_coefficient("3×(x+2)^2-6×π", "x", coefficient1);
-  // TODO: decomment when enable 3-degree polynomes
-  //const char * coefficient2[] = {"2+32×x", "2", "6", "2", 0}; //2×n^3+6×n^2+2×n+2+32×x
-  //assert_reduced_expression_has_polynomial_coefficient("2×(n+1)^3-4n+32×x", "n", coefficient2);
+  const char * coefficient2[] = {"2+32×x", "2", "6", "2", 0}; //2×n^3+6×n^2+2×n+2+32×x
+  assert_reduced_expression_has_polynomial_coefficient("2×(n+1)^3-4n+32×x", "n", coefficient2);
   const char * coefficient3[] = {"1", "-π", "1", 0}; //x^2-π×x+1
   assert_reduced_expression_has_polynomial_coefficient("x^2-π×x+1", "x", coefficient3);
 
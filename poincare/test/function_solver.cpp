@@ -169,6 +169,19 @@ QUIZ_CASE(poincare_function_extremum) {
         Coordinate2D<double>(NAN, 0.0)};
       assert_points_of_interest_are(PointOfInterestType::Minimum, numberOfMinima, minima, "0", nullptr, "a", 100.0, -0.1, -1.0);
     }
+    {
+      constexpr int numberOfMinima = 1;
+      Coordinate2D<double> minima[numberOfMinima] = {
+        Coordinate2D<double>(0.90856029641606983, -2.0442606669361569)};
+      assert_points_of_interest_are(PointOfInterestType::Minimum, numberOfMinima, minima, "a^4-3a", nullptr, "a", -1.0, 0.1, 5.0);
+    }
+    {
+      // Not differentiable at the minimum
+      constexpr int numberOfMinima = 1;
+      Coordinate2D<double> minima[numberOfMinima] = {
+        Coordinate2D<double>(0.25, 0.0)};
+      assert_points_of_interest_are(PointOfInterestType::Minimum, numberOfMinima, minima, "abs(a-0.25)", nullptr, "a", -1.0, 0.1, 1.0);
+    }
   }
 }
 
@@ -239,6 +252,19 @@ QUIZ_CASE(poincare_function_root) {
       Coordinate2D<double>(99.8, 0.0)};
     assert_points_of_interest_are(PointOfInterestType::Root, numberOfRoots, roots, "0", nullptr, "a", 100.0, -0.1, -1.0);
   }
+  {
+    constexpr int numberOfRoots = 1;
+    Coordinate2D<double> roots[numberOfRoots] = {
+      Coordinate2D<double>(2.0945514815423265, 0.0)};
+    assert_points_of_interest_are(PointOfInterestType::Root, numberOfRoots, roots, "a^3-2a-5", nullptr, "a", -1.0, 0.1, 5.0);
+  }
+  {
+    // The sign change at the pole is not a root
+    constexpr int numberOfRoots = 1;
+    Coordinate2D<double> roots[numberOfRoots] = {
+      Coordinate2D<double>(NAN, 0.0)};
+    assert_points_of_interest_are(PointOfInterestType::Root, numberOfRoots, roots, "1/a", nullptr, "a", -1.0, 0.1, 1.0);
+  }
 }
 
 QUIZ_CASE(poincare_function_intersection) {
@@ -285,3 +311,42 @@ QUIZ_CASE(poincare_function_intersection) {
     assert_points_of_interest_are(PointOfInterestType::Intersection, numberOfIntersections, intersections, "cos(a)", "0", "a", 500.0, -0.1, -1.0);
   }
 }
+
+void assert_polynomial_roots_are(std::initializer_list<std::complex<double>> coefficients, std::initializer_list<std::complex<double>> roots) {
+  constexpr int maxDegree = Solver::k_maxPolynomialRootsDegree;
+  std::complex<double> coefficientsArray[maxDegree + 1];
+  int degree = -1;
+  for (std::complex<double> c : coefficients) {
+    coefficientsArray[++degree] = c;
+  }
+  std::complex<double> obtainedRoots[maxDegree];
+  int numberOfRoots = Solver::PolynomialRoots(coefficientsArray, degree, obtainedRoots);
+  quiz_assert(numberOfRoots == static_cast<int>(roots.size()));
+  int i = 0;
+  for (std::complex<double> root : roots) {
+    quiz_assert(std::abs(obtainedRoots[i] - root) <= 1E-9 * std::max(1.0, std::abs(root)));
+    quiz_assert((obtainedRoots[i].real() == 0.0) == (root.real() == 0.0) && (obtainedRoots[i].imag() == 0.0) == (root.imag() == 0.0));
+    i++;
+  }
+}
+
+QUIZ_CASE(poincare_function_polynomial_roots) {
+  // x^3-2x-5
+  assert_polynomial_roots_are({-5.0, -2.0, 0.0, 1.0}, {{-1.0472757407711633, -1.135939889088928}, {-1.0472757407711633, 1.135939889088928}, 2.0945514815423265});
+  // x^4+1
+  assert_polynomial_roots_are({1.0, 0.0, 0.0, 0.0, 1.0}, {{-M_SQRT1_2, -M_SQRT1_2}, {-M_SQRT1_2, M_SQRT1_2}, {M_SQRT1_2, -M_SQRT1_2}, {M_SQRT1_2, M_SQRT1_2}});
+  // x^4-1
+  assert_polynomial_roots_are({-1.0, 0.0, 0.0, 0.0, 1.0}, {-1.0, {0.0, -1.0}, {0.0, 1.0}, 1.0});
+  // x^5-x^3 = x^3(x-1)(x+1)
+  assert_polynomial_roots_are({0.0, 0.0, 0.0, -1.0, 0.0, 1.0}, {-1.0, 0.0, 1.0});
+  // (x-1)^3(x+2) = x^4-x^3-3x^2+5x-2
+  assert_polynomial_roots_are({-2.0, 5.0, -3.0, -1.0, 1.0}, {-2.0, 1.0});
+  // (x-1)(x-2)...(x-10)
+  assert_polynomial_roots_are({3628800.0, -10628640.0, 12753576.0, -8409500.0, 3416930.0, -902055.0, 157773.0, -18150.0, 1320.0, -55.0, 1.0}, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0});
+  // x^3-𝐢
+  assert_polynomial_roots_are({{0.0, -1.0}, 0.0, 0.0, 1.0}, {{-0.86602540378443865, 0.5}, {0.0, -1.0}, {0.86602540378443865, 0.5}});
+  // Infinite coefficient
+  std::complex<double> coefficients[] = {INFINITY, 0.0, 0.0, 1.0};
+  std::complex<double> roots[3];
+  quiz_assert(Solver::PolynomialRoots(coefficients, 3, roots) == -1);
+}
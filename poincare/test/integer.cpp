@@ -1,3 +1,4 @@
+#include <poincare/arithmetic.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -198,7 +199,7 @@ QUIZ_CASE(poincare_integer_pow) {
 }
 
 static inline void assert_factorial_to(const Integer i, const Integer j) {
-  quiz_assert(Integer::NaturalOrder(Integer::Factorial(i), j) == 0);
+  quiz_assert(Integer::NaturalOrder(Arithmetic::Factorial(i), j) == 0);
 }
 
 QUIZ_CASE(poincare_integer_factorial) {
@@ -415,6 +415,30 @@ QUIZ_CASE(poincare_parsing_identifiers) {
   assert_text_not_parsable("log(1,2,3)");
 }
 
+QUIZ_CASE(poincare_parsing_reserved_names) {
+  // Reserved functions and special identifiers
+  const char * reservedNames[] = {"abs", "acosh", "binomcdf", "log", "normcdf", "normcdf2", "prediction95", "√", "ans", "inf", "undef", "unreal", "u", "v", "w"};
+  for (const char * name : reservedNames) {
+    quiz_assert_print_if_failure(Parser::IsReservedName(name, strlen(name)), name);
+  }
+  // Prefixes and extensions of reserved names
+  const char * customNames[] = {"a", "ab", "absx", "lo", "logs", "normcdf3", "prediction9", "an", "ansi", "x", "uv", "f"};
+  for (const char * name : customNames) {
+    quiz_assert_print_if_failure(!Parser::IsReservedName(name, strlen(name)), name);
+  }
+  // Names in the parsed text are not null-terminated
+  quiz_assert(Parser::IsReservedName("sinh(x)", 3));
+  quiz_assert(Parser::IsReservedName("sinh(x)", 4));
+  quiz_assert(!Parser::IsReservedName("sinh(x)", 5));
+
+  // Identifiers used several times are resolved once in the context
+  assert_reduce("x→f(x)");
+  assert_parsed_expression_is("f(2)×f(2)", Multiplication::Builder(Function::Builder("f", 1, BasedInteger::Builder(2)), Function::Builder("f", 1, BasedInteger::Builder(2))));
+  assert_parsed_expression_is("a×f(a)×a", Multiplication::Builder({Symbol::Builder("a", 1), Function::Builder("f", 1, Symbol::Builder("a", 1)), Symbol::Builder("a", 1)}));
+  Ion::Storage::sharedStorage()->recordNamed("f.func").destroy();
+  assert_parsed_expression_is("f(2)×f(2)", Multiplication::Builder({Symbol::Builder("f", 1), Parenthesis::Builder(BasedInteger::Builder(2)), Multiplication::Builder(Symbol::Builder("f", 1), Parenthesis::Builder(BasedInteger::Builder(2)))}));
+}
+
 QUIZ_CASE(poincare_parsing_parse_store) {
   assert_parsed_expression_is("1→a", Store::Builder(BasedInteger::Builder(1),Symbol::Builder("a",1)));
   assert_parsed_expression_is("1→e", Store::Builder(BasedInteger::Builder(1),Symbol::Builder("e",1)));
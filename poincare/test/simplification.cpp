@@ -581,6 +581,8 @@ QUIZ_CASE(poincare_simplification_function) {
   assert_parsed_expression_simplify_to("arg(1+𝐢)", "π/4");
   assert_parsed_expression_simplify_to("binomial(20,3)", "1140");
   assert_parsed_expression_simplify_to("binomial(20,10)", "184756");
+  assert_parsed_expression_simplify_to("binomial(1000,500)", "270288240945436569515614693625975275496152008446548287007392875106625428705522193898612483924502370165362606085021546104802209750050679917549894219699518475423665484263751733356162464079737887344364574161119497604571044985756287880514600994219426752366915856603136862602484428109296905863799821216320");
+  assert_parsed_expression_simplify_to("binomial(2000,1000)", "binomial(2000,1000)");
   assert_parsed_expression_simplify_to("ceil(-1.3)", "-1");
   assert_parsed_expression_simplify_to("ceil(2π)", "7");
   assert_parsed_expression_simplify_to("ceil(123456789012345678901234567892/3)", "41152263004115226300411522631");
@@ -594,6 +596,8 @@ QUIZ_CASE(poincare_simplification_function) {
   assert_parsed_expression_simplify_to("rem(-19,3)", "2");
   assert_parsed_expression_simplify_to("rem(19,0)", Undefined::Name());
   assert_parsed_expression_simplify_to("99!", "933262154439441526816992388562667004907159682643816214685929638952175999932299156089414639761565182862536979208272237582511852109168640000000000000000000000");
+  assert_parsed_expression_simplify_to("170!", "7257415615307998967396728211129263114716991681296451376543577798900561843401706157852350749242617459511490991237838520776666022565442753025328900773207510902400430280058295603966612599658257104398558294257568966313439612262571094946806711205568880457193340212661452800000000000000000000000000000000000000000");
+  assert_parsed_expression_simplify_to("171!", "171!");
   assert_parsed_expression_simplify_to("factor(-10008/6895)", "-\u00122^3×3^2×139\u0013/\u00125×7×197\u0013");
   assert_parsed_expression_simplify_to("factor(1008/6895)", "\u00122^4×3^2\u0013/\u00125×197\u0013");
   assert_parsed_expression_simplify_to("factor(10007)", "10007");
@@ -632,13 +636,60 @@ QUIZ_CASE(poincare_simplification_function) {
   assert_parsed_expression_simplify_to("sign(2+𝐢)", "sign(2+𝐢)");
   /* Test with no symbolic computation to check that n inside a sum expression
    * is not replaced by Undefined */
-  assert_parsed_expression_simplify_to("sum(n,n,1,5)", "sum(n,n,1,5)", User, Radian, Cartesian, ReplaceAllSymbolsWithDefinitionsOrUndefined);
+  assert_parsed_expression_simplify_to("sum(n!,n,1,5)", "sum(n!,n,1,5)", User, Radian, Cartesian, ReplaceAllSymbolsWithDefinitionsOrUndefined);
   assert_parsed_expression_simplify_to("sum(1/n,n,1,2)", "sum(1/n,n,1,2)", User, Radian, Cartesian, ReplaceAllSymbolsWithDefinitionsOrUndefined);
+  // The closed form of the sum is found with n as its parameter
+  assert_parsed_expression_simplify_to("sum(n,n,1,5)", "15", User, Radian, Cartesian, ReplaceAllSymbolsWithDefinitionsOrUndefined);
   assert_parsed_expression_simplify_to("permute(99,4)", "90345024");
+  assert_parsed_expression_simplify_to("permute(8000,3)", "511808016000");
   assert_parsed_expression_simplify_to("permute(20,-10)", Undefined::Name());
   assert_parsed_expression_simplify_to("re(1/2)", "1/2");
 }
 
+QUIZ_CASE(poincare_simplification_derivative) {
+  assert_parsed_expression_simplify_to("diff(3×x, x, 3)", "3");
+  assert_parsed_expression_simplify_to("diff(a, x, 2)", "0");
+  assert_parsed_expression_simplify_to("diff(x^2, x, x)", "2×x");
+  assert_parsed_expression_simplify_to("diff(x^2, x, 3)", "6");
+  assert_parsed_expression_simplify_to("diff(x^3+2×x, x, a)", "3×a^2+2");
+  assert_parsed_expression_simplify_to("diff(1/x, x, 2)", "-1/4");
+  assert_parsed_expression_simplify_to("diff(√(x), x, 4)", "1/4");
+  assert_parsed_expression_simplify_to("diff(x×ℯ^x, x, 0)", "1");
+  assert_parsed_expression_simplify_to("diff(2^x, x, 0)", "ln(2)");
+  assert_parsed_expression_simplify_to("diff(sin(x), x, π)", "-1");
+  assert_parsed_expression_simplify_to("diff(cos(2×x), x, 0)", "0");
+  assert_parsed_expression_simplify_to("diff(sin(x), x, 90)", "0", User, Degree);
+  assert_parsed_expression_simplify_to("diff(cos(x), x, 90)", "-π/180", User, Degree);
+  assert_parsed_expression_simplify_to("diff(atan(x), x, 1)", "1/2");
+  assert_parsed_expression_simplify_to("diff(asin(x), x, 0)", "180/π", User, Degree);
+  assert_parsed_expression_simplify_to("diff(sinh(x), x, 0)", "1");
+  assert_parsed_expression_simplify_to("diff(tanh(x), x, 0)", "1");
+  assert_parsed_expression_simplify_to("diff(ln(x), x, 2)", "1/2", User, Radian, Cartesian);
+  assert_parsed_expression_simplify_to("diff(log(x,2), x, 1)", "1/ln(2)", User, Radian, Cartesian);
+  assert_parsed_expression_simplify_to("diff(ln(x^2+1), x, 1)", "1");
+  // Real logarithms are only derived on their domain of definition
+  assert_parsed_expression_simplify_to("diff(ln(x), x, 2)", "diff(ln(x),x,2)", User, Radian, Real);
+  // Functions without derivation rule are approximated
+  assert_parsed_expression_simplify_to("diff(abs(x), x, 2)", "diff(abs(x),x,2)");
+  assert_parsed_expression_simplify_to("diff(x^2+abs(x), x, 2)", "diff(abs(x),x,2)+4");
+}
+
+QUIZ_CASE(poincare_simplification_sum) {
+  assert_parsed_expression_simplify_to("sum(k,k,1,100)", "5050");
+  assert_parsed_expression_simplify_to("sum(k^2,k,1,1000000)", "333333833333500000");
+  assert_parsed_expression_simplify_to("sum(k×x,k,1,3)", "6×x");
+  assert_parsed_expression_simplify_to("sum(k,k,1,0)", "0");
+  assert_parsed_expression_simplify_to("sum(k,k,3,1)", "sum(k,k,3,1)");
+  assert_parsed_expression_simplify_to("sum(2^k,k,0,10)", "2047");
+  assert_parsed_expression_simplify_to("sum(x×3^(k+1),k,1,3)", "117×x");
+  assert_parsed_expression_simplify_to("sum((1/2)^k,k,0,inf)", "2");
+  assert_parsed_expression_simplify_to("sum(3/10^k,k,1,inf)", "1/3");
+  assert_parsed_expression_simplify_to("sum((-1)^k/3^k,k,0,inf)", "3/4");
+  assert_parsed_expression_simplify_to("sum(2^k,k,0,inf)", "sum(2^k,k,0,inf)");
+  assert_parsed_expression_simplify_to("sum(x^k,k,0,3)", "sum(x^k,k,0,3)");
+  assert_parsed_expression_simplify_to("sum(1/k^2,k,1,inf)", "sum(1/k^2,k,1,inf)");
+}
+
 QUIZ_CASE(poincare_simplification_trigonometry_functions) {
   // -- sin/cos -> tan
   assert_parsed_expression_simplify_to("sin(x)/cos(x)", "tan(x)");
@@ -864,6 +915,7 @@ QUIZ_CASE(poincare_simplification_matrix) {
 
   // Power Matrix
   assert_parsed_expression_simplify_to("[[1,2,3][4,5,6][7,8,9]]^3", "[[468,576,684][1062,1305,1548][1656,2034,2412]]");
+  assert_parsed_expression_simplify_to("[[1,1][1,0]]^50", "[[20365011074,12586269025][12586269025,7778742049]]");
   assert_parsed_expression_simplify_to("[[1,2,3][4,5,6]]^(-1)", Undefined::Name());
   assert_parsed_expression_simplify_to("[[1,2][3,4]]^(-1)", "[[-2,1][3/2,-1/2]]");
 
@@ -1140,7 +1192,7 @@ QUIZ_CASE(poincare_simplification_complex_format) {
   assert_parsed_expression_simplify_to("conj(-2+2×𝐢+𝐢)", "-2-3×𝐢", User, Radian, Cartesian);
   assert_parsed_expression_simplify_to("cos(12)", "cos(12)", User, Radian, Cartesian);
   assert_parsed_expression_simplify_to("cos(12+𝐢)", "cos(12+𝐢)", User, Radian, Cartesian);
-  assert_parsed_expression_simplify_to("diff(3×x, x, 3)", "diff(3×x,x,3)", User, Radian, Cartesian);
+  assert_parsed_expression_simplify_to("diff(3×x, x, 3)", "3", User, Radian, Cartesian);
   assert_parsed_expression_simplify_to("quo(34,x)", "quo(34,x)", User, Radian, Cartesian);
   assert_parsed_expression_simplify_to("rem(5,3)", "2", User, Radian, Cartesian);
   assert_parsed_expression_simplify_to("floor(x)", "floor(x)", User, Radian, Cartesian);
@@ -1382,6 +1434,19 @@ QUIZ_CASE(poincare_simplification_mix) {
   assert_expression_simplifies_approximates_to<double>("abs(√(300000.0003^23))", "9.702740901018ᴇ62", Degree, Cartesian, 13);
 }
 
+QUIZ_CASE(poincare_simplification_repeated_subexpressions) {
+  // Identical subtrees are reduced once, the others reuse the memoized result
+  assert_parsed_expression_simplify_to("sin(x)+sin(x)+sin(x)", "3×sin(x)");
+  assert_parsed_expression_simplify_to("cos(π/4)×x+cos(π/4)×y+cos(π/4)", "\u0012√(2)×x+√(2)×y+√(2)\u0013/2");
+  assert_parsed_expression_simplify_to("[[cos(π/4),cos(π/4)][cos(π/4),cos(π/4)]]", "[[√(2)/2,√(2)/2][√(2)/2,√(2)/2]]");
+  // The same subtree reduces differently depending on its parent
+  assert_parsed_expression_simplify_to("ln(ℯ^x)+ℯ^x", "x+ℯ^x");
+  assert_parsed_expression_simplify_to("2^x×log(2^x,2)", "2^x×x");
+  assert_parsed_expression_simplify_to("2×(x+1)+(x+1)", "3×x+3");
+  // Random nodes are not memoized
+  assert_parsed_expression_simplify_to("random()+random()", "random()+random()");
+}
+
 QUIZ_CASE(poincare_hyperbolic_trigonometry) {
   // Exact values
   assert_parsed_expression_simplify_to("sinh(0)", "0");
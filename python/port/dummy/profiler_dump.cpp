@@ -0,0 +1,4 @@
+#include "../profiler.h"
+
+void MicroPython::Profiler::dump() {
+}
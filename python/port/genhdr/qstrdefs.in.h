@@ -101,9 +101,11 @@ Q(__new__)
 Q(__next__)
 Q(__path__)
 Q(__qualname__)
+Q(__radd__)
 Q(__repl_print__)
 Q(__repr__)
 Q(__reversed__)
+Q(__rsub__)
 Q(__setitem__)
 Q(__str__)
 Q(__sub__)
@@ -370,6 +372,34 @@ Q(KEY_EE)
 Q(KEY_ANS)
 Q(KEY_EXE)
 
+// Native and viper emitters QSTRs
+Q(None)
+Q(ViperTypeError)
+Q(native)
+Q(viper)
+Q(ptr)
+Q(ptr8)
+Q(ptr16)
+Q(ptr32)
+Q(uint)
+
+// gc QSTRs
+Q(gc)
+Q(collect)
+Q(enable)
+Q(disable)
+Q(isenabled)
+Q(mem_free)
+Q(mem_alloc)
+Q(mem_peak)
+Q(stats)
+Q(collections)
+Q(collect_ms)
+Q(max_pause_ms)
+Q(peak)
+Q(largest_free)
+Q(fragmentation)
+
 // Kandinsky QSTRs
 Q(kandinsky)
 Q(color)
@@ -452,6 +482,23 @@ Q(scatter)
 Q(show)
 Q(text)
 
+// Numpy QSTRs
+Q(numpy)
+Q(ndarray)
+Q(float32)
+Q(float64)
+Q(arange)
+Q(array)
+Q(dot)
+Q(dtype)
+Q(endpoint)
+Q(linspace)
+Q(num)
+Q(ones)
+Q(size)
+Q(tolist)
+Q(zeros)
+
 // Turtle QSTRs
 Q(turtle)
 Q(forward)
@@ -1,8 +1,11 @@
 #include "helpers.h"
 #include "port.h"
+#include "profiler.h"
 #include <ion.h>
 extern "C" {
 #include "mphalport.h"
+#include "py/bc.h"
+#include "py/runtime.h"
 }
 
 bool micropython_port_vm_hook_loop() {
@@ -24,6 +27,34 @@ bool micropython_port_vm_hook_loop() {
   return micropython_port_interrupt_if_needed();
 }
 
+void micropython_port_vm_hook_profile(const mp_code_state_t * code_state, const uint8_t * ip) {
+  static int c = 0;
+  c = (c + 1) % MicroPython::Profiler::k_samplingPeriod;
+  if (c != 0) {
+    return;
+  }
+  // Find the line as mp_execute_bytecode does to build tracebacks
+  const byte * prelude = code_state->fun_bc->bytecode;
+  MP_BC_PRELUDE_SIG_DECODE(prelude);
+  MP_BC_PRELUDE_SIZE_DECODE(prelude);
+  const byte * bytecodeStart = prelude + n_info + n_cell;
+#if !MICROPY_PERSISTENT_CODE
+  bytecodeStart = static_cast<const byte *>(MP_ALIGN(bytecodeStart, sizeof(mp_uint_t)));
+#endif
+  size_t bc = ip - bytecodeStart;
+#if MICROPY_PERSISTENT_CODE
+  qstr block = prelude[0] | (prelude[1] << 8);
+  qstr sourceFile = prelude[2] | (prelude[3] << 8);
+  prelude += 4;
+#else
+  qstr block = mp_decode_uint_value(prelude);
+  prelude = mp_decode_uint_skip(prelude);
+  qstr sourceFile = mp_decode_uint_value(prelude);
+  prelude = mp_decode_uint_skip(prelude);
+#endif
+  MicroPython::Profiler::sample(sourceFile, block, mp_bytecode_get_source_line(prelude, bc));
+}
+
 void micropython_port_vm_hook_refresh_print() {
   assert(MicroPython::ExecutionEnvironment::currentExecutionEnvironment() != nullptr);
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->refreshPrintOutput();
@@ -31,6 +62,8 @@ void micropython_port_vm_hook_refresh_print() {
 
 bool micropython_port_interruptible_msleep(int32_t delay) {
   assert(delay >= 0);
+  // Lines printed before sleeping are expected to be seen during the sleep
+  micropython_port_vm_hook_refresh_print();
   /* We don't use millis because the systick drifts when changing the HCLK
    * frequency. */
   constexpr int32_t interruptionCheckDelay = 100;
@@ -61,3 +94,10 @@ bool micropython_port_interrupt_if_needed() {
 int micropython_port_random() {
   return Ion::random();
 }
+
+void * micropython_port_commit_exec(void * buffer, size_t size) {
+  if (!Ion::makeExecutable(buffer, size)) {
+    mp_raise_msg(&mp_type_MemoryError, "cannot execute native code");
+  }
+  return buffer;
+}
@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // These methods return true if they have been interrupted
@@ -14,6 +15,12 @@ void micropython_port_vm_hook_refresh_print();
 bool micropython_port_interruptible_msleep(int32_t delay);
 bool micropython_port_interrupt_if_needed();
 int micropython_port_random();
+// Samples the line executed by the VM when the profiler is running
+extern bool micropython_port_profiler_running;
+struct _mp_code_state_t;
+void micropython_port_vm_hook_profile(const struct _mp_code_state_t * code_state, const uint8_t * ip);
+// Makes emitted machine code executable, raises MemoryError if impossible
+void * micropython_port_commit_exec(void * buffer, size_t size);
 
 #ifdef __cplusplus
 }
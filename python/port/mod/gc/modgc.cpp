@@ -0,0 +1,94 @@
+extern "C" {
+#include "modgc.h"
+#include <py/gc.h>
+#include <py/mpstate.h>
+#include <py/runtime.h>
+}
+#include <algorithm>
+
+/* The statistics cover the collections since MicroPython was initialized,
+ * either triggered by an allocation or by gc.collect(). The peak usage is
+ * sampled before each collection, when the heap is the fullest, and when it
+ * is queried. */
+
+static size_t sNumberOfCollections = 0;
+static uint32_t sCollectionMilliseconds = 0;
+static uint32_t sLongestCollectionMilliseconds = 0;
+static size_t sPeakUsage = 0;
+
+static size_t usedBytesUpdatingPeak() {
+  gc_info_t info;
+  gc_info(&info);
+  sPeakUsage = std::max(sPeakUsage, info.used);
+  return info.used;
+}
+
+void modgc_reset_statistics() {
+  sNumberOfCollections = 0;
+  sCollectionMilliseconds = 0;
+  sLongestCollectionMilliseconds = 0;
+  sPeakUsage = 0;
+}
+
+void modgc_collection_will_start() {
+  usedBytesUpdatingPeak();
+}
+
+void modgc_collection_did_end(uint32_t milliseconds) {
+  sNumberOfCollections++;
+  sCollectionMilliseconds += milliseconds;
+  sLongestCollectionMilliseconds = std::max(sLongestCollectionMilliseconds, milliseconds);
+}
+
+mp_obj_t modgc_collect() {
+  gc_collect();
+  return mp_const_none;
+}
+
+mp_obj_t modgc_enable() {
+  MP_STATE_MEM(gc_auto_collect_enabled) = 1;
+  return mp_const_none;
+}
+
+mp_obj_t modgc_disable() {
+  MP_STATE_MEM(gc_auto_collect_enabled) = 0;
+  return mp_const_none;
+}
+
+mp_obj_t modgc_isenabled() {
+  return mp_obj_new_bool(MP_STATE_MEM(gc_auto_collect_enabled));
+}
+
+mp_obj_t modgc_mem_free() {
+  gc_info_t info;
+  gc_info(&info);
+  return mp_obj_new_int_from_uint(info.free);
+}
+
+mp_obj_t modgc_mem_alloc() {
+  return mp_obj_new_int_from_uint(usedBytesUpdatingPeak());
+}
+
+mp_obj_t modgc_mem_peak() {
+  usedBytesUpdatingPeak();
+  return mp_obj_new_int_from_uint(sPeakUsage);
+}
+
+mp_obj_t modgc_stats() {
+  // Measure the heap before allocating the dictionary
+  usedBytesUpdatingPeak();
+  gc_info_t info;
+  gc_info(&info);
+  size_t largestFree = info.max_free * MICROPY_BYTES_PER_GC_BLOCK;
+  /* The fragmentation is the share of the free memory that is not part of the
+   * largest free chunk, which bounds the largest possible allocation. */
+  mp_int_t fragmentation = info.free > 0 ? 100 - 100 * largestFree / info.free : 0;
+  mp_obj_t stats = mp_obj_new_dict(6);
+  mp_obj_dict_store(stats, MP_ROM_QSTR(MP_QSTR_collections), mp_obj_new_int_from_uint(sNumberOfCollections));
+  mp_obj_dict_store(stats, MP_ROM_QSTR(MP_QSTR_collect_ms), mp_obj_new_int_from_uint(sCollectionMilliseconds));
+  mp_obj_dict_store(stats, MP_ROM_QSTR(MP_QSTR_max_pause_ms), mp_obj_new_int_from_uint(sLongestCollectionMilliseconds));
+  mp_obj_dict_store(stats, MP_ROM_QSTR(MP_QSTR_peak), mp_obj_new_int_from_uint(sPeakUsage));
+  mp_obj_dict_store(stats, MP_ROM_QSTR(MP_QSTR_largest_free), mp_obj_new_int_from_uint(largestFree));
+  mp_obj_dict_store(stats, MP_ROM_QSTR(MP_QSTR_fragmentation), MP_OBJ_NEW_SMALL_INT(fragmentation));
+  return stats;
+}
@@ -0,0 +1,15 @@
+#include <py/obj.h>
+
+mp_obj_t modgc_collect();
+mp_obj_t modgc_enable();
+mp_obj_t modgc_disable();
+mp_obj_t modgc_isenabled();
+mp_obj_t modgc_mem_free();
+mp_obj_t modgc_mem_alloc();
+mp_obj_t modgc_mem_peak();
+mp_obj_t modgc_stats();
+
+// Called by the port to measure the collections
+void modgc_reset_statistics();
+void modgc_collection_will_start();
+void modgc_collection_did_end(uint32_t milliseconds);
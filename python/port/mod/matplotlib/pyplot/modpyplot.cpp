@@ -1,5 +1,6 @@
 extern "C" {
 #include "modpyplot.h"
+#include "../../numpy/modnumpy.h"
 }
 #include <assert.h>
 #include <escher/palette.h>
@@ -12,12 +13,19 @@ static int paletteIndex = 0;
 
 // Private helper
 
-// Method to populate items with a scalar or an array argument
+// Method to populate items with a scalar, a list, a tuple or a numpy array argument
 
 static size_t extractArgument(mp_obj_t arg, mp_obj_t ** items) {
   size_t itemLength;
   if (mp_obj_is_type(arg, &mp_type_tuple) || mp_obj_is_type(arg, &mp_type_list)) {
     mp_obj_get_array(arg, &itemLength, items);
+  } else if (mp_obj_is_type(arg, &modnumpy_array_type)) {
+    const modnumpy_array_t * array = static_cast<const modnumpy_array_t *>(MP_OBJ_TO_PTR(arg));
+    itemLength = array->length;
+    *items = m_new(mp_obj_t, itemLength);
+    for (size_t i = 0; i < itemLength; i++) {
+      (*items)[i] = mp_obj_new_float(modnumpy_array_get(array, i));
+    }
   } else {
     itemLength = 1;
     *items = m_new(mp_obj_t, 1);
@@ -291,9 +299,8 @@ mp_obj_t modpyplot_hist(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args )
   mp_obj_t * edgeItems;
   size_t nBins;
   // bin arg
-  if (n_args >= 2 && (mp_obj_is_type(args[1], &mp_type_tuple) || mp_obj_is_type(args[1], &mp_type_list))) {
-    size_t nEdges;
-    mp_obj_get_array(args[1], &nEdges, &edgeItems);
+  if (n_args >= 2 && (mp_obj_is_type(args[1], &mp_type_tuple) || mp_obj_is_type(args[1], &mp_type_list) || mp_obj_is_type(args[1], &modnumpy_array_type))) {
+    size_t nEdges = extractArgument(args[1], &edgeItems);
     nBins = nEdges -1;
   } else {
     nBins = 10;
@@ -0,0 +1,513 @@
+extern "C" {
+#include "modnumpy.h"
+#include <py/formatfloat.h>
+#include <py/runtime.h>
+#include <py/smallint.h>
+}
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// Private helpers
+
+static size_t itemSize(qstr dtype) {
+  return dtype == MP_QSTR_float32 ? sizeof(float) : sizeof(double);
+}
+
+static inline void setItem(modnumpy_array_t * array, size_t index, mp_float_t value) {
+  if (array->dtype == MP_QSTR_float32) {
+    static_cast<float *>(array->items)[index] = value;
+  } else {
+    static_cast<double *>(array->items)[index] = value;
+  }
+}
+
+static modnumpy_array_t * arrayFromObject(mp_obj_t o) {
+  if (!mp_obj_is_type(o, &modnumpy_array_type)) {
+    mp_raise_TypeError("expected an array");
+  }
+  return static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(o));
+}
+
+static modnumpy_array_t * arrayFromIterable(mp_obj_t o, qstr dtype) {
+  if (mp_obj_is_type(o, &modnumpy_array_type)) {
+    modnumpy_array_t * source = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(o));
+    modnumpy_array_t * array = modnumpy_array_new(dtype, source->length);
+    if (dtype == source->dtype) {
+      memcpy(array->items, source->items, source->length * itemSize(dtype));
+    } else {
+      for (size_t i = 0; i < source->length; i++) {
+        setItem(array, i, modnumpy_array_get(source, i));
+      }
+    }
+    return array;
+  }
+  if (mp_obj_is_type(o, &mp_type_tuple) || mp_obj_is_type(o, &mp_type_list)) {
+    size_t length;
+    mp_obj_t * items;
+    mp_obj_get_array(o, &length, &items);
+    modnumpy_array_t * array = modnumpy_array_new(dtype, length);
+    for (size_t i = 0; i < length; i++) {
+      setItem(array, i, mp_obj_get_float(items[i]));
+    }
+    return array;
+  }
+  /* Generic iterables such as range need to tell their length beforehand. A
+   * user-defined iterable can yield fewer items than it claims: the array
+   * then only keeps the items actually yielded. */
+  modnumpy_array_t * array = modnumpy_array_new(dtype, MP_OBJ_SMALL_INT_VALUE(mp_obj_len(o)));
+  mp_obj_iter_buf_t iterBuffer;
+  mp_obj_t iterator = mp_getiter(o, &iterBuffer);
+  mp_obj_t item;
+  size_t i = 0;
+  while (i < array->length && (item = mp_iternext(iterator)) != MP_OBJ_STOP_ITERATION) {
+    setItem(array, i++, mp_obj_get_float(item));
+  }
+  array->length = i;
+  return array;
+}
+
+/* Reductions accept arrays as well as any iterable of numbers, which is then
+ * converted to an array. */
+static modnumpy_array_t * arrayOrConversion(mp_obj_t o) {
+  if (mp_obj_is_type(o, &modnumpy_array_type)) {
+    return static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(o));
+  }
+  return arrayFromIterable(o, MP_QSTR_float64);
+}
+
+static qstr dtypeFromKeywordArgument(mp_map_t * kw_args, qstr defaultDtype) {
+  mp_map_elem_t * elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_dtype), MP_MAP_LOOKUP);
+  if (elem == nullptr || elem->value == mp_const_none) {
+    return defaultDtype;
+  }
+  if (elem->value == MP_OBJ_FROM_PTR(&mp_type_float)) {
+    return MP_QSTR_float64;
+  }
+  if (mp_obj_is_str(elem->value)) {
+    const char * name = mp_obj_str_get_str(elem->value);
+    if (strcmp(name, qstr_str(MP_QSTR_float32)) == 0) {
+      return MP_QSTR_float32;
+    }
+    if (strcmp(name, qstr_str(MP_QSTR_float64)) == 0) {
+      return MP_QSTR_float64;
+    }
+  }
+  mp_raise_TypeError("data type not understood");
+}
+
+static size_t lengthFromObject(mp_obj_t o) {
+  mp_int_t length = mp_obj_get_int(o);
+  if (length < 0) {
+    mp_raise_ValueError("negative dimensions are not allowed");
+  }
+  return length;
+}
+
+static void checkEqualLengths(const modnumpy_array_t * a, const modnumpy_array_t * b) {
+  if (a->length != b->length) {
+    mp_raise_ValueError("operands could not be broadcast together");
+  }
+}
+
+// Applies f to each item of an array, or to a scalar
+template<typename F>
+static mp_obj_t map(mp_obj_t o, F f) {
+  if (!mp_obj_is_type(o, &modnumpy_array_type)) {
+    return mp_obj_new_float(f(mp_obj_get_float(o)));
+  }
+  modnumpy_array_t * source = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(o));
+  modnumpy_array_t * result = modnumpy_array_new(source->dtype, source->length);
+  for (size_t i = 0; i < source->length; i++) {
+    setItem(result, i, f(modnumpy_array_get(source, i)));
+  }
+  return MP_OBJ_FROM_PTR(result);
+}
+
+static inline mp_float_t applyOperator(mp_binary_op_t op, mp_float_t a, mp_float_t b) {
+  switch (op) {
+    case MP_BINARY_OP_ADD:
+      return a + b;
+    case MP_BINARY_OP_SUBTRACT:
+      return a - b;
+    case MP_BINARY_OP_MULTIPLY:
+      return a * b;
+    case MP_BINARY_OP_TRUE_DIVIDE:
+      return a / b;
+    default:
+      assert(op == MP_BINARY_OP_POWER);
+      return pow(a, b);
+  }
+}
+
+static mp_float_t dot(const modnumpy_array_t * a, const modnumpy_array_t * b) {
+  checkEqualLengths(a, b);
+  mp_float_t result = 0.0;
+  for (size_t i = 0; i < a->length; i++) {
+    result += modnumpy_array_get(a, i) * modnumpy_array_get(b, i);
+  }
+  return result;
+}
+
+static size_t sliceLength(const mp_bound_slice_t * slice) {
+  if (slice->step > 0) {
+    return slice->start < slice->stop ? (slice->stop - slice->start + slice->step - 1) / slice->step : 0;
+  }
+  return slice->start >= slice->stop ? (slice->start - slice->stop) / -slice->step + 1 : 0;
+}
+
+// Array
+
+modnumpy_array_t * modnumpy_array_new(qstr dtype, size_t length) {
+  assert(dtype == MP_QSTR_float32 || dtype == MP_QSTR_float64);
+  // The size in bytes would wrap around and allocate a too small buffer
+  if (length > SIZE_MAX / itemSize(dtype)) {
+    mp_raise_msg(&mp_type_MemoryError, "array is too big");
+  }
+  modnumpy_array_t * array = m_new_obj(modnumpy_array_t);
+  array->base.type = &modnumpy_array_type;
+  array->dtype = dtype;
+  array->length = length;
+  array->items = m_new(byte, length * itemSize(dtype));
+  return array;
+}
+
+mp_float_t modnumpy_array_get(const modnumpy_array_t * array, size_t index) {
+  assert(index < array->length);
+  if (array->dtype == MP_QSTR_float32) {
+    return static_cast<const float *>(array->items)[index];
+  }
+  return static_cast<const double *>(array->items)[index];
+}
+
+void modnumpy_array_print(const mp_print_t * print, mp_obj_t self_in, mp_print_kind_t kind) {
+  modnumpy_array_t * self = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(self_in));
+  // Single precision items are printed with the digits they actually hold
+  const int precision = self->dtype == MP_QSTR_float32 ? 7 : 16;
+  char buffer[32];
+  mp_print_str(print, "array([");
+  for (size_t i = 0; i < self->length; i++) {
+    if (i > 0) {
+      mp_print_str(print, ", ");
+    }
+    mp_format_float(modnumpy_array_get(self, i), buffer, sizeof(buffer), 'g', precision, '\0');
+    mp_print_str(print, buffer);
+    if (strchr(buffer, '.') == nullptr && strchr(buffer, 'e') == nullptr && strchr(buffer, 'n') == nullptr) {
+      mp_print_str(print, ".0");
+    }
+  }
+  mp_print_str(print, "]");
+  if (self->dtype != MP_QSTR_float64) {
+    mp_printf(print, ", dtype=%q", self->dtype);
+  }
+  mp_print_str(print, ")");
+}
+
+mp_obj_t modnumpy_array_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+  switch (op) {
+    case MP_UNARY_OP_LEN:
+      return MP_OBJ_NEW_SMALL_INT(arrayFromObject(self_in)->length);
+    case MP_UNARY_OP_POSITIVE:
+      return map(self_in, [](mp_float_t x) { return x; });
+    case MP_UNARY_OP_NEGATIVE:
+      return map(self_in, [](mp_float_t x) { return -x; });
+    case MP_UNARY_OP_ABS:
+      return map(self_in, [](mp_float_t x) { return static_cast<mp_float_t>(fabs(x)); });
+    default:
+      return MP_OBJ_NULL;
+  }
+}
+
+/* Operations are done item by item, between two arrays of the same length or
+ * between an array and a scalar. The result is in single precision only if
+ * both operands are. In-place operations write into the left operand. */
+mp_obj_t modnumpy_array_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
+  bool reversed = false;
+  bool inPlace = false;
+  if (op >= MP_BINARY_OP_REVERSE_OR) {
+    op = static_cast<mp_binary_op_t>(op - (MP_BINARY_OP_REVERSE_OR - MP_BINARY_OP_OR));
+    reversed = true;
+  } else if (op >= MP_BINARY_OP_INPLACE_OR && op <= MP_BINARY_OP_INPLACE_POWER) {
+    op = static_cast<mp_binary_op_t>(op + (MP_BINARY_OP_OR - MP_BINARY_OP_INPLACE_OR));
+    inPlace = true;
+  }
+  modnumpy_array_t * lhs = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(lhs_in));
+  const modnumpy_array_t * rhsArray = nullptr;
+  mp_float_t rhsScalar = 0.0;
+  if (mp_obj_is_type(rhs_in, &modnumpy_array_type)) {
+    rhsArray = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(rhs_in));
+  } else if (!mp_obj_get_float_maybe(rhs_in, &rhsScalar)) {
+    return MP_OBJ_NULL;
+  }
+  if (op == MP_BINARY_OP_MAT_MULTIPLY && rhsArray != nullptr && !inPlace) {
+    return mp_obj_new_float(dot(lhs, rhsArray));
+  }
+  if (op != MP_BINARY_OP_ADD && op != MP_BINARY_OP_SUBTRACT && op != MP_BINARY_OP_MULTIPLY && op != MP_BINARY_OP_TRUE_DIVIDE && op != MP_BINARY_OP_POWER) {
+    return MP_OBJ_NULL;
+  }
+  qstr dtype = lhs->dtype;
+  if (rhsArray != nullptr) {
+    checkEqualLengths(lhs, rhsArray);
+    if (rhsArray->dtype == MP_QSTR_float64) {
+      dtype = MP_QSTR_float64;
+    }
+  }
+  modnumpy_array_t * result = inPlace ? lhs : modnumpy_array_new(dtype, lhs->length);
+  for (size_t i = 0; i < lhs->length; i++) {
+    mp_float_t a = modnumpy_array_get(lhs, i);
+    mp_float_t b = rhsArray != nullptr ? modnumpy_array_get(rhsArray, i) : rhsScalar;
+    setItem(result, i, reversed ? applyOperator(op, b, a) : applyOperator(op, a, b));
+  }
+  return MP_OBJ_FROM_PTR(result);
+}
+
+// destination[0] is set to the attribute, destination[1] to self for methods
+void modnumpy_array_attr(mp_obj_t self_in, qstr attribute, mp_obj_t * destination) {
+  if (destination[0] != MP_OBJ_NULL) {
+    // Attributes cannot be stored nor deleted
+    return;
+  }
+  modnumpy_array_t * self = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(self_in));
+  if (attribute == MP_QSTR_dtype) {
+    destination[0] = MP_OBJ_NEW_QSTR(self->dtype);
+  } else if (attribute == MP_QSTR_size) {
+    destination[0] = MP_OBJ_NEW_SMALL_INT(self->length);
+  } else {
+    mp_map_elem_t * elem = mp_map_lookup(&modnumpy_array_type.locals_dict->map, MP_OBJ_NEW_QSTR(attribute), MP_MAP_LOOKUP);
+    if (elem != nullptr) {
+      mp_convert_member_lookup(self_in, &modnumpy_array_type, elem->value, destination);
+    }
+  }
+}
+
+/* value is MP_OBJ_SENTINEL to load, MP_OBJ_NULL to delete and the value to
+ * store otherwise. Unlike numpy, slices are copies and not views. */
+mp_obj_t modnumpy_array_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
+  modnumpy_array_t * self = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(self_in));
+  if (value == MP_OBJ_NULL) {
+    return MP_OBJ_NULL;
+  }
+  if (!mp_obj_is_type(index, &mp_type_slice)) {
+    size_t i = mp_get_index(self->base.type, self->length, index, false);
+    if (value == MP_OBJ_SENTINEL) {
+      return mp_obj_new_float(modnumpy_array_get(self, i));
+    }
+    setItem(self, i, mp_obj_get_float(value));
+    return mp_const_none;
+  }
+  mp_bound_slice_t slice;
+  mp_seq_get_fast_slice_indexes(self->length, index, &slice);
+  size_t length = sliceLength(&slice);
+  if (value == MP_OBJ_SENTINEL) {
+    modnumpy_array_t * result = modnumpy_array_new(self->dtype, length);
+    for (size_t k = 0; k < length; k++) {
+      setItem(result, k, modnumpy_array_get(self, slice.start + k * slice.step));
+    }
+    return MP_OBJ_FROM_PTR(result);
+  }
+  if (mp_obj_is_type(value, &modnumpy_array_type)) {
+    modnumpy_array_t * source = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(value));
+    if (source->length != length) {
+      mp_raise_ValueError("could not broadcast input array into the slice");
+    }
+    if (source == self) {
+      // Items could be overwritten before being read
+      source = arrayFromIterable(value, source->dtype);
+    }
+    for (size_t k = 0; k < length; k++) {
+      setItem(self, slice.start + k * slice.step, modnumpy_array_get(source, k));
+    }
+  } else {
+    mp_float_t scalar = mp_obj_get_float(value);
+    for (size_t k = 0; k < length; k++) {
+      setItem(self, slice.start + k * slice.step, scalar);
+    }
+  }
+  return mp_const_none;
+}
+
+typedef struct _modnumpy_array_it_t {
+  mp_obj_base_t base;
+  mp_fun_1_t iternext;
+  mp_obj_t array;
+  size_t index;
+} modnumpy_array_it_t;
+
+static mp_obj_t modnumpy_array_it___next__(mp_obj_t self_in) {
+  modnumpy_array_it_t * self = static_cast<modnumpy_array_it_t *>(MP_OBJ_TO_PTR(self_in));
+  modnumpy_array_t * array = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(self->array));
+  if (self->index >= array->length) {
+    return MP_OBJ_STOP_ITERATION;
+  }
+  return mp_obj_new_float(modnumpy_array_get(array, self->index++));
+}
+
+mp_obj_t modnumpy_array_getiter(mp_obj_t self_in, mp_obj_iter_buf_t * iter_buf) {
+  static_assert(sizeof(modnumpy_array_it_t) <= sizeof(mp_obj_iter_buf_t), "The iterator does not fit in its buffer");
+  modnumpy_array_it_t * iterator = reinterpret_cast<modnumpy_array_it_t *>(iter_buf);
+  iterator->base.type = &mp_type_polymorph_iter;
+  iterator->iternext = modnumpy_array_it___next__;
+  iterator->array = self_in;
+  iterator->index = 0;
+  return MP_OBJ_FROM_PTR(iterator);
+}
+
+mp_int_t modnumpy_array_get_buffer(mp_obj_t self_in, mp_buffer_info_t * bufinfo, mp_uint_t flags) {
+  modnumpy_array_t * self = static_cast<modnumpy_array_t *>(MP_OBJ_TO_PTR(self_in));
+  bufinfo->buf = self->items;
+  bufinfo->len = self->length * itemSize(self->dtype);
+  bufinfo->typecode = self->dtype == MP_QSTR_float32 ? 'f' : 'd';
+  return 0;
+}
+
+mp_obj_t modnumpy_array_tolist(mp_obj_t self_in) {
+  modnumpy_array_t * self = arrayFromObject(self_in);
+  mp_obj_t list = mp_obj_new_list(self->length, nullptr);
+  mp_obj_t * items;
+  size_t length;
+  mp_obj_list_get(list, &length, &items);
+  for (size_t i = 0; i < length; i++) {
+    items[i] = mp_obj_new_float(modnumpy_array_get(self, i));
+  }
+  return list;
+}
+
+// Creation
+
+mp_obj_t modnumpy_array(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  if (n_args > 1) {
+    mp_raise_TypeError("array() takes 1 positional argument");
+  }
+  qstr defaultDtype = mp_obj_is_type(args[0], &modnumpy_array_type) ? arrayFromObject(args[0])->dtype : MP_QSTR_float64;
+  return MP_OBJ_FROM_PTR(arrayFromIterable(args[0], dtypeFromKeywordArgument(kw_args, defaultDtype)));
+}
+
+mp_obj_t modnumpy_zeros(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  if (n_args > 1) {
+    mp_raise_TypeError("zeros() takes 1 positional argument");
+  }
+  modnumpy_array_t * array = modnumpy_array_new(dtypeFromKeywordArgument(kw_args, MP_QSTR_float64), lengthFromObject(args[0]));
+  // The IEEE 754 representation of 0.0 is all bits cleared
+  memset(array->items, 0, array->length * itemSize(array->dtype));
+  return MP_OBJ_FROM_PTR(array);
+}
+
+mp_obj_t modnumpy_ones(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  if (n_args > 1) {
+    mp_raise_TypeError("ones() takes 1 positional argument");
+  }
+  modnumpy_array_t * array = modnumpy_array_new(dtypeFromKeywordArgument(kw_args, MP_QSTR_float64), lengthFromObject(args[0]));
+  for (size_t i = 0; i < array->length; i++) {
+    setItem(array, i, 1.0);
+  }
+  return MP_OBJ_FROM_PTR(array);
+}
+
+/* arange(stop), arange(start, stop) or arange(start, stop, step)
+ * The stop value is excluded. */
+mp_obj_t modnumpy_arange(size_t n_args, const mp_obj_t * args) {
+  mp_float_t start = n_args >= 2 ? mp_obj_get_float(args[0]) : 0.0;
+  mp_float_t stop = mp_obj_get_float(args[n_args >= 2 ? 1 : 0]);
+  mp_float_t step = n_args >= 3 ? mp_obj_get_float(args[2]) : 1.0;
+  if (step == 0.0) {
+    mp_raise_ValueError("step cannot be zero");
+  }
+  mp_float_t length = ceil((stop - start) / step);
+  if (!(length < MP_SMALL_INT_MAX)) {
+    mp_raise_ValueError("invalid range");
+  }
+  modnumpy_array_t * array = modnumpy_array_new(MP_QSTR_float64, length > 0.0 ? static_cast<size_t>(length) : 0);
+  for (size_t i = 0; i < array->length; i++) {
+    setItem(array, i, start + i * step);
+  }
+  return MP_OBJ_FROM_PTR(array);
+}
+
+/* linspace(start, stop, num, KW : endpoint, dtype)
+ * num evenly spaced values from start to stop, 50 by default. The stop value
+ * is included unless endpoint is False. */
+mp_obj_t modnumpy_linspace(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  if (n_args > 3) {
+    mp_raise_TypeError("linspace() takes from 2 to 3 positional arguments");
+  }
+  mp_float_t start = mp_obj_get_float(args[0]);
+  mp_float_t stop = mp_obj_get_float(args[1]);
+  size_t num = 50;
+  mp_map_elem_t * elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_num), MP_MAP_LOOKUP);
+  if (n_args == 3) {
+    num = lengthFromObject(args[2]);
+  } else if (elem != nullptr) {
+    num = lengthFromObject(elem->value);
+  }
+  elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_endpoint), MP_MAP_LOOKUP);
+  bool endpoint = elem == nullptr || mp_obj_is_true(elem->value);
+  modnumpy_array_t * array = modnumpy_array_new(dtypeFromKeywordArgument(kw_args, MP_QSTR_float64), num);
+  size_t divisions = endpoint ? num - 1 : num;
+  for (size_t i = 0; i < num; i++) {
+    // Interpolating avoids accumulating rounding errors, and hits stop exactly
+    setItem(array, i, divisions == 0 ? start : start + (stop - start) * i / divisions);
+  }
+  return MP_OBJ_FROM_PTR(array);
+}
+
+// Reductions
+
+mp_obj_t modnumpy_sum(mp_obj_t a) {
+  modnumpy_array_t * array = arrayOrConversion(a);
+  mp_float_t result = 0.0;
+  for (size_t i = 0; i < array->length; i++) {
+    result += modnumpy_array_get(array, i);
+  }
+  return mp_obj_new_float(result);
+}
+
+static mp_obj_t extremum(mp_obj_t a, bool minimum) {
+  modnumpy_array_t * array = arrayOrConversion(a);
+  if (array->length == 0) {
+    mp_raise_ValueError("zero-size array to reduction operation");
+  }
+  mp_float_t result = modnumpy_array_get(array, 0);
+  for (size_t i = 1; i < array->length; i++) {
+    mp_float_t item = modnumpy_array_get(array, i);
+    // Comparisons with nan are false, so nan is propagated as in numpy
+    if (isnan(item) || (minimum ? item < result : item > result)) {
+      result = item;
+    }
+  }
+  return mp_obj_new_float(result);
+}
+
+mp_obj_t modnumpy_min(mp_obj_t a) {
+  return extremum(a, true);
+}
+
+mp_obj_t modnumpy_max(mp_obj_t a) {
+  return extremum(a, false);
+}
+
+mp_obj_t modnumpy_dot(mp_obj_t a, mp_obj_t b) {
+  return mp_obj_new_float(dot(arrayOrConversion(a), arrayOrConversion(b)));
+}
+
+// Elementwise functions
+
+mp_obj_t modnumpy_sqrt(mp_obj_t a) {
+  return map(a, [](mp_float_t x) { return static_cast<mp_float_t>(sqrt(x)); });
+}
+
+mp_obj_t modnumpy_exp(mp_obj_t a) {
+  return map(a, [](mp_float_t x) { return static_cast<mp_float_t>(exp(x)); });
+}
+
+mp_obj_t modnumpy_log(mp_obj_t a) {
+  return map(a, [](mp_float_t x) { return static_cast<mp_float_t>(log(x)); });
+}
+
+mp_obj_t modnumpy_sin(mp_obj_t a) {
+  return map(a, [](mp_float_t x) { return static_cast<mp_float_t>(sin(x)); });
+}
+
+mp_obj_t modnumpy_cos(mp_obj_t a) {
+  return map(a, [](mp_float_t x) { return static_cast<mp_float_t>(cos(x)); });
+}
@@ -0,0 +1,45 @@
+#include <py/obj.h>
+
+/* A numpy-like subset working on one-dimensional arrays of floats. The items
+ * are stored contiguously, in single (float32) or double (float64) precision,
+ * instead of as a list of boxed float objects. */
+
+typedef struct _modnumpy_array_t {
+  mp_obj_base_t base;
+  qstr dtype; // MP_QSTR_float32 or MP_QSTR_float64
+  size_t length;
+  void * items;
+} modnumpy_array_t;
+
+extern const mp_obj_type_t modnumpy_array_type;
+
+modnumpy_array_t * modnumpy_array_new(qstr dtype, size_t length);
+mp_float_t modnumpy_array_get(const modnumpy_array_t * array, size_t index);
+
+// Array type
+
+void modnumpy_array_print(const mp_print_t * print, mp_obj_t self_in, mp_print_kind_t kind);
+mp_obj_t modnumpy_array_unary_op(mp_unary_op_t op, mp_obj_t self_in);
+mp_obj_t modnumpy_array_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t rhs_in);
+void modnumpy_array_attr(mp_obj_t self_in, qstr attribute, mp_obj_t * destination);
+mp_obj_t modnumpy_array_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value);
+mp_obj_t modnumpy_array_getiter(mp_obj_t self_in, mp_obj_iter_buf_t * iter_buf);
+mp_int_t modnumpy_array_get_buffer(mp_obj_t self_in, mp_buffer_info_t * bufinfo, mp_uint_t flags);
+mp_obj_t modnumpy_array_tolist(mp_obj_t self_in);
+
+// Module functions
+
+mp_obj_t modnumpy_array(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
+mp_obj_t modnumpy_zeros(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
+mp_obj_t modnumpy_ones(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
+mp_obj_t modnumpy_arange(size_t n_args, const mp_obj_t * args);
+mp_obj_t modnumpy_linspace(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
+mp_obj_t modnumpy_sum(mp_obj_t a);
+mp_obj_t modnumpy_min(mp_obj_t a);
+mp_obj_t modnumpy_max(mp_obj_t a);
+mp_obj_t modnumpy_dot(mp_obj_t a, mp_obj_t b);
+mp_obj_t modnumpy_sqrt(mp_obj_t a);
+mp_obj_t modnumpy_exp(mp_obj_t a);
+mp_obj_t modnumpy_log(mp_obj_t a);
+mp_obj_t modnumpy_sin(mp_obj_t a);
+mp_obj_t modnumpy_cos(mp_obj_t a);
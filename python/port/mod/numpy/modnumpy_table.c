@@ -0,0 +1,68 @@
+#include "modnumpy.h"
+
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_array_tolist_obj, modnumpy_array_tolist);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(modnumpy_array_obj, 1, modnumpy_array);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(modnumpy_zeros_obj, 1, modnumpy_zeros);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(modnumpy_ones_obj, 1, modnumpy_ones);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modnumpy_arange_obj, 1, 3, modnumpy_arange);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(modnumpy_linspace_obj, 2, modnumpy_linspace);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_sum_obj, modnumpy_sum);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_min_obj, modnumpy_min);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_max_obj, modnumpy_max);
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(modnumpy_dot_obj, modnumpy_dot);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_sqrt_obj, modnumpy_sqrt);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_exp_obj, modnumpy_exp);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_log_obj, modnumpy_log);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_sin_obj, modnumpy_sin);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_cos_obj, modnumpy_cos);
+
+STATIC const mp_rom_map_elem_t modnumpy_array_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_dot), MP_ROM_PTR(&modnumpy_dot_obj) },
+  { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&modnumpy_max_obj) },
+  { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&modnumpy_min_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&modnumpy_sum_obj) },
+  { MP_ROM_QSTR(MP_QSTR_tolist), MP_ROM_PTR(&modnumpy_array_tolist_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(modnumpy_array_locals_dict, modnumpy_array_locals_dict_table);
+
+const mp_obj_type_t modnumpy_array_type = {
+  { &mp_type_type },
+  .name = MP_QSTR_ndarray,
+  .print = modnumpy_array_print,
+  .unary_op = modnumpy_array_unary_op,
+  .binary_op = modnumpy_array_binary_op,
+  .attr = modnumpy_array_attr,
+  .subscr = modnumpy_array_subscr,
+  .getiter = modnumpy_array_getiter,
+  .buffer_p = { .get_buffer = modnumpy_array_get_buffer },
+  .locals_dict = (mp_obj_dict_t*)&modnumpy_array_locals_dict,
+};
+
+STATIC const mp_rom_map_elem_t modnumpy_module_globals_table[] = {
+  { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_numpy) },
+  { MP_ROM_QSTR(MP_QSTR_ndarray), MP_ROM_PTR(&modnumpy_array_type) },
+  { MP_ROM_QSTR(MP_QSTR_float32), MP_ROM_QSTR(MP_QSTR_float32) },
+  { MP_ROM_QSTR(MP_QSTR_float64), MP_ROM_QSTR(MP_QSTR_float64) },
+  { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&modnumpy_array_obj) },
+  { MP_ROM_QSTR(MP_QSTR_zeros), MP_ROM_PTR(&modnumpy_zeros_obj) },
+  { MP_ROM_QSTR(MP_QSTR_ones), MP_ROM_PTR(&modnumpy_ones_obj) },
+  { MP_ROM_QSTR(MP_QSTR_arange), MP_ROM_PTR(&modnumpy_arange_obj) },
+  { MP_ROM_QSTR(MP_QSTR_linspace), MP_ROM_PTR(&modnumpy_linspace_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&modnumpy_sum_obj) },
+  { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&modnumpy_min_obj) },
+  { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&modnumpy_max_obj) },
+  { MP_ROM_QSTR(MP_QSTR_dot), MP_ROM_PTR(&modnumpy_dot_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sqrt), MP_ROM_PTR(&modnumpy_sqrt_obj) },
+  { MP_ROM_QSTR(MP_QSTR_exp), MP_ROM_PTR(&modnumpy_exp_obj) },
+  { MP_ROM_QSTR(MP_QSTR_log), MP_ROM_PTR(&modnumpy_log_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sin), MP_ROM_PTR(&modnumpy_sin_obj) },
+  { MP_ROM_QSTR(MP_QSTR_cos), MP_ROM_PTR(&modnumpy_cos_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(modnumpy_module_globals, modnumpy_module_globals_table);
+
+const mp_obj_module_t modnumpy_module = {
+  .base = { &mp_type_module },
+  .globals = (mp_obj_dict_t*)&modnumpy_module_globals,
+};
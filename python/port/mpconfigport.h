@@ -57,6 +57,10 @@
 // Whether to support bytearray object
 #define MICROPY_PY_BUILTINS_BYTEARRAY (0)
 
+// Whether to try the reversed operation when an operand does not support it,
+// so that numpy arrays can be the right operand of scalars (2 - array)
+#define MICROPY_PY_REVERSE_SPECIAL_METHODS (1)
+
 // Whether to support frozenset object
 #define MICROPY_PY_BUILTINS_FROZENSET (1)
 
@@ -108,11 +112,35 @@
 // Function to seed URANDOM with on init
 #define MICROPY_PY_URANDOM_SEED_INIT_FUNC micropython_port_random()
 
+/* Whether to compile @micropython.native and @micropython.viper functions to
+ * machine code. Bytecode remains the default. The code is allocated in the
+ * Python heap, so it is garbage collected like any other object. */
+#if defined(__arm__) && defined(__thumb2__)
+#define MICROPY_EMIT_THUMB (1)
+#elif defined(__x86_64__) && defined(__linux__)
+#define MICROPY_EMIT_X64 (1)
+#endif
+
 // Make a pointer to RAM callable (eg set lower bit for Thumb code)
 // (This scheme won't work if we want to mix Thumb and normal ARM code.)
+#if MICROPY_EMIT_THUMB
+#define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((mp_uint_t)(p) | 1))
+#else
 #define MICROPY_MAKE_POINTER_CALLABLE(p) (p)
+#endif
+
+// Flush the caches or change the memory protection of freshly emitted code
+#define MP_PLAT_COMMIT_EXEC(buf, size, reloc) micropython_port_commit_exec(buf, size)
+
+// code_state and ip are the frame and instruction pointer in mp_execute_bytecode
+#define MICROPY_VM_HOOK_LOOP \
+    micropython_port_vm_hook_loop(); \
+    if (micropython_port_profiler_running) { \
+        micropython_port_vm_hook_profile(code_state, ip); \
+    }
 
-#define MICROPY_VM_HOOK_LOOP micropython_port_vm_hook_loop();
+// Native code has no frame to profile, but it is interrupted like bytecode
+#define MICROPY_NATIVE_HOOK_LOOP micropython_port_vm_hook_loop();
 
 typedef intptr_t mp_int_t; // must be pointer size
 typedef uintptr_t mp_uint_t; // must be pointer size
@@ -126,19 +154,23 @@ typedef long mp_off_t;
 
 #define MP_STATE_PORT MP_STATE_VM
 
+extern const struct _mp_obj_module_t modgc_module;
 extern const struct _mp_obj_module_t modion_module;
 extern const struct _mp_obj_module_t modkandinsky_module;
 extern const struct _mp_obj_module_t modmatplotlib_module;
 extern const struct _mp_obj_module_t modpyplot_module;
+extern const struct _mp_obj_module_t modnumpy_module;
 extern const struct _mp_obj_module_t modtime_module;
 extern const struct _mp_obj_module_t modos_module;
 extern const struct _mp_obj_module_t modturtle_module;
 
 #define MICROPY_PORT_BUILTIN_MODULES \
+    { MP_ROM_QSTR(MP_QSTR_gc), MP_ROM_PTR(&modgc_module) }, \
     { MP_ROM_QSTR(MP_QSTR_ion), MP_ROM_PTR(&modion_module) }, \
     { MP_ROM_QSTR(MP_QSTR_kandinsky), MP_ROM_PTR(&modkandinsky_module) }, \
     { MP_ROM_QSTR(MP_QSTR_matplotlib), MP_ROM_PTR(&modmatplotlib_module) }, \
     { MP_ROM_QSTR(MP_QSTR_matplotlib_dot_pyplot), MP_ROM_PTR(&modpyplot_module) }, \
+    { MP_ROM_QSTR(MP_QSTR_numpy), MP_ROM_PTR(&modnumpy_module) }, \
     { MP_ROM_QSTR(MP_QSTR_time), MP_ROM_PTR(&modtime_module) }, \
     { MP_ROM_QSTR(MP_QSTR_os), MP_ROM_PTR(&modos_module) }, \
     { MP_ROM_QSTR(MP_QSTR_turtle), MP_ROM_PTR(&modturtle_module) }, \
@@ -59,6 +59,7 @@ extern "C" {
 #include "py/runtime.h"
 #include "py/stackctrl.h"
 #include "mphalport.h"
+#include "mod/gc/modgc.h"
 #include "mod/turtle/modturtle.h"
 #include "mod/matplotlib/pyplot/modpyplot.h"
 }
@@ -185,6 +186,7 @@ void MicroPython::init(void * heapStart, void * heapEnd) {
   mp_stack_set_limit(29152);
 #endif
   gc_init(heapStart, heapEnd);
+  modgc_reset_statistics();
   mp_init();
 }
 
@@ -333,11 +335,14 @@ void gc_collect_regs_and_stack(void) {
 }
 
 void gc_collect(void) {
+  uint64_t startTime = Ion::Timing::millis();
+  modgc_collection_will_start();
   gc_collect_start();
   modturtle_gc_collect();
   modpyplot_gc_collect();
   gc_collect_regs_and_stack();
   gc_collect_end();
+  modgc_collection_did_end(Ion::Timing::millis() - startTime);
 }
 
 void nlr_jump_fail(void *val) {
@@ -32,6 +32,7 @@ public:
   virtual void hideAnyDisplayedViewController() {}
 
   virtual void printText(const char * text, size_t length) {}
+  // Display the text printed since the last refresh, if any
   virtual void refreshPrintOutput() {}
   void interrupt();
 };
@@ -0,0 +1,137 @@
+#include "profiler.h"
+#include <ion/timing.h>
+#include <assert.h>
+extern "C" {
+#include "helpers.h"
+#include <py/mpprint.h>
+}
+
+bool micropython_port_profiler_running = false;
+
+namespace MicroPython {
+namespace Profiler {
+
+static uint64_t sStartTime = 0;
+static uint64_t sLastSampleTime = 0;
+static uint32_t sTotalMilliseconds = 0;
+static int sNumberOfHotSpots = 0;
+static HotSpot sHotSpots[k_maxNumberOfHotSpots];
+
+void start() {
+  sNumberOfHotSpots = 0;
+  sTotalMilliseconds = 0;
+  sStartTime = Ion::Timing::millis();
+  sLastSampleTime = sStartTime;
+  micropython_port_profiler_running = true;
+}
+
+void stop() {
+  if (!micropython_port_profiler_running) {
+    return;
+  }
+  micropython_port_profiler_running = false;
+  sTotalMilliseconds = Ion::Timing::millis() - sStartTime;
+  // Insertion sort by decreasing time, the table is tiny
+  for (int i = 1; i < sNumberOfHotSpots; i++) {
+    HotSpot hotSpot = sHotSpots[i];
+    int j = i - 1;
+    while (j >= 0 && sHotSpots[j].milliseconds < hotSpot.milliseconds) {
+      sHotSpots[j + 1] = sHotSpots[j];
+      j--;
+    }
+    sHotSpots[j + 1] = hotSpot;
+  }
+}
+
+bool isRunning() {
+  return micropython_port_profiler_running;
+}
+
+void sample(qstr sourceFile, qstr block, size_t line) {
+  assert(micropython_port_profiler_running);
+  uint64_t now = Ion::Timing::millis();
+  uint32_t elapsed = now - sLastSampleTime;
+  if (elapsed == 0) {
+    // The line executed when the clock ticks is charged for the whole tick
+    return;
+  }
+  sLastSampleTime = now;
+  int cheapestIndex = 0;
+  for (int i = 0; i < sNumberOfHotSpots; i++) {
+    HotSpot * hotSpot = &sHotSpots[i];
+    if (hotSpot->line == line && hotSpot->sourceFile == sourceFile && hotSpot->block == block) {
+      hotSpot->milliseconds += elapsed;
+      return;
+    }
+    if (hotSpot->milliseconds < sHotSpots[cheapestIndex].milliseconds) {
+      cheapestIndex = i;
+    }
+  }
+  if (sNumberOfHotSpots < k_maxNumberOfHotSpots) {
+    sHotSpots[sNumberOfHotSpots++] = {sourceFile, block, static_cast<uint16_t>(line), elapsed};
+    return;
+  }
+  HotSpot * replaced = &sHotSpots[cheapestIndex];
+  *replaced = {sourceFile, block, static_cast<uint16_t>(line), replaced->milliseconds + elapsed};
+}
+
+int numberOfHotSpots() {
+  return sNumberOfHotSpots;
+}
+
+const HotSpot * hotSpotAtIndex(int index) {
+  assert(index >= 0 && index < sNumberOfHotSpots);
+  return &sHotSpots[index];
+}
+
+uint32_t totalMilliseconds() {
+  return sTotalMilliseconds;
+}
+
+/* mp_printf can only output to a mp_print_t, which can either raise or grow a
+ * buffer on the heap when full. This one truncates the output. */
+struct TruncatingBuffer {
+  char * buffer;
+  size_t size;
+  size_t length;
+};
+
+static void printToTruncatingBuffer(void * data, const char * text, size_t length) {
+  TruncatingBuffer * b = static_cast<TruncatingBuffer *>(data);
+  for (size_t i = 0; i < length && b->length + 1 < b->size; i++) {
+    b->buffer[b->length++] = text[i];
+  }
+  b->buffer[b->length] = 0;
+}
+
+int serializeSummary(char * buffer, size_t bufferSize) {
+  assert(bufferSize > 0);
+  TruncatingBuffer b = {buffer, bufferSize, 0};
+  buffer[0] = 0;
+  mp_print_t print = {&b, printToTruncatingBuffer};
+  mp_printf(&print, "Profile: %ums", sTotalMilliseconds);
+  return b.length;
+}
+
+int serializeHotSpot(int index, char * buffer, size_t bufferSize) {
+  assert(bufferSize > 0);
+  const HotSpot * hotSpot = hotSpotAtIndex(index);
+  TruncatingBuffer b = {buffer, bufferSize, 0};
+  buffer[0] = 0;
+  mp_print_t print = {&b, printToTruncatingBuffer};
+  // Commands typed in the console have no source file
+  if (hotSpot->sourceFile == MP_QSTRnull) {
+    mp_printf(&print, "line %u", hotSpot->line);
+  } else {
+    mp_printf(&print, "%q:%u", hotSpot->sourceFile, hotSpot->line);
+  }
+  if (hotSpot->block != MP_QSTRnull && hotSpot->block != MP_QSTR__lt_module_gt_) {
+    mp_printf(&print, " in %q", hotSpot->block);
+  }
+  uint32_t percentage = sTotalMilliseconds > 0 ? 100 * hotSpot->milliseconds / sTotalMilliseconds : 0;
+  mp_printf(&print, " %u%% %ums", percentage, hotSpot->milliseconds);
+  return b.length;
+}
+
+}
+}
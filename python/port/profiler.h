@@ -0,0 +1,53 @@
+#ifndef PYTHON_PORT_PROFILER_H
+#define PYTHON_PORT_PROFILER_H
+
+extern "C" {
+#include <stddef.h>
+#include <stdint.h>
+#include <py/qstr.h>
+}
+
+namespace MicroPython {
+
+/* The profiler samples the line executed by the virtual machine, every
+ * k_samplingPeriod loop iterations, and charges it the time elapsed since the
+ * previous sample. The most expensive lines are kept in a fixed-size table:
+ * when it is full, the cheapest line is replaced and the newcomer inherits its
+ * time (space-saving algorithm), so that a line which becomes hot late in the
+ * run still makes it to the report.
+ * Only the innermost Python frame is known when sampling, so a line calling a
+ * slow Python function is not charged for it. */
+
+namespace Profiler {
+
+constexpr int k_samplingPeriod = 64;
+constexpr int k_maxNumberOfHotSpots = 16;
+constexpr int k_maxNumberOfReportedHotSpots = 8;
+
+struct HotSpot {
+  qstr sourceFile;
+  qstr block;
+  uint16_t line;
+  uint32_t milliseconds;
+};
+
+void start();
+void stop();
+bool isRunning();
+void sample(qstr sourceFile, qstr block, size_t line);
+
+// Hot spots are sorted by decreasing time once the profiler is stopped
+int numberOfHotSpots();
+const HotSpot * hotSpotAtIndex(int index);
+uint32_t totalMilliseconds();
+int serializeSummary(char * buffer, size_t bufferSize);
+int serializeHotSpot(int index, char * buffer, size_t bufferSize);
+
+// Write the report on the standard output of the headless simulator
+void dump();
+
+}
+
+}
+
+#endif
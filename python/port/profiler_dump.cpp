@@ -0,0 +1,15 @@
+#include "profiler.h"
+#include <ion/console.h>
+
+void MicroPython::Profiler::dump() {
+  constexpr size_t k_bufferSize = 64;
+  char buffer[k_bufferSize];
+  serializeSummary(buffer, k_bufferSize);
+  Ion::Console::writeLine(buffer, false);
+  Ion::Console::writeChar('\n');
+  for (int i = 0; i < numberOfHotSpots(); i++) {
+    serializeHotSpot(i, buffer, k_bufferSize);
+    Ion::Console::writeLine(buffer, false);
+    Ion::Console::writeChar('\n');
+  }
+}
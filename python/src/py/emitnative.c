@@ -1968,16 +1968,28 @@ STATIC void emit_native_rot_three(emit_t *emit) {
     emit_post_push_reg_reg_reg(emit, vtype0, REG_TEMP0, vtype2, REG_TEMP2, vtype1, REG_TEMP1);
 }
 
+// Loops of native code check for a pending exception on their backward jumps,
+// as the VM does, so that they can be interrupted. A label that has not been
+// assigned yet has an offset of -1 during the compute passes.
+STATIC void emit_native_check_pending_if_backward(emit_t *emit, mp_uint_t label) {
+    if (emit->as->base.label_offsets[label] <= emit->as->base.code_offset) {
+        need_stack_settled(emit);
+        emit_call(emit, MP_F_NATIVE_CHECK_PENDING);
+    }
+}
+
 STATIC void emit_native_jump(emit_t *emit, mp_uint_t label) {
     DEBUG_printf("jump(label=" UINT_FMT ")\n", label);
     emit_native_pre(emit);
     // need to commit stack because we are jumping elsewhere
     need_stack_settled(emit);
+    emit_native_check_pending_if_backward(emit, label);
     ASM_JUMP(emit->as, label);
     emit_post(emit);
 }
 
 STATIC void emit_native_jump_helper(emit_t *emit, bool cond, mp_uint_t label, bool pop) {
+    emit_native_check_pending_if_backward(emit, label);
     vtype_kind_t vtype = peek_vtype(emit, 0);
     if (vtype == VTYPE_PYOBJ) {
         emit_pre_pop_reg(emit, &vtype, REG_ARG_1);
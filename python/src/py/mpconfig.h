@@ -502,6 +502,11 @@
 #define MICROPY_VM_HOOK_LOOP
 #endif
 
+// Hook for native code on the backward jumps of its loops
+#ifndef MICROPY_NATIVE_HOOK_LOOP
+#define MICROPY_NATIVE_HOOK_LOOP
+#endif
+
 // Hook for the VM just before return opcode is finished being interpreted
 #ifndef MICROPY_VM_HOOK_RETURN
 #define MICROPY_VM_HOOK_RETURN
@@ -211,6 +211,13 @@ STATIC bool mp_native_yield_from(mp_obj_t gen, mp_obj_t send_value, mp_obj_t *re
     return false;
 }
 
+// Called on the backward jumps of native code, where the VM would run its loop
+// hook and raise the pending exception
+STATIC void mp_native_check_pending(void) {
+    MICROPY_NATIVE_HOOK_LOOP
+    mp_handle_pending();
+}
+
 #if MICROPY_PY_BUILTINS_FLOAT
 
 STATIC mp_obj_t mp_obj_new_float_from_f(float f) {
@@ -313,7 +320,8 @@ const mp_fun_table_t mp_fun_table = {
     #else
     NULL,
     #endif
-    // Additional entries for dynamic runtime, starts at index 50
+    mp_native_check_pending,
+    // Additional entries for dynamic runtime, starts at index 51
     memset,
     memmove,
     gc_realloc,
@@ -323,7 +331,11 @@ const mp_fun_table_t mp_fun_table = {
     mp_obj_get_type,
     mp_obj_new_str,
     mp_obj_new_bytes,
+    #if MICROPY_PY_BUILTINS_BYTEARRAY
     mp_obj_new_bytearray_by_ref,
+    #else
+    NULL, // only used by dynamic native modules
+    #endif
     mp_obj_new_float_from_f,
     mp_obj_new_float_from_d,
     mp_obj_get_float_to_f,
@@ -82,6 +82,7 @@ typedef enum {
     MP_F_SMALL_INT_MODULO,
     MP_F_NATIVE_YIELD_FROM,
     MP_F_SETJMP,
+    MP_F_NATIVE_CHECK_PENDING,
     MP_F_NUMBER_OF,
 } mp_fun_kind_t;
 
@@ -136,7 +137,8 @@ typedef struct _mp_fun_table_t {
     mp_int_t (*small_int_modulo)(mp_int_t dividend, mp_int_t divisor);
     bool (*yield_from)(mp_obj_t gen, mp_obj_t send_value, mp_obj_t *ret_value);
     void *setjmp;
-    // Additional entries for dynamic runtime, starts at index 50
+    void (*check_pending)(void);
+    // Additional entries for dynamic runtime, starts at index 51
     void *(*memset_)(void *s, int c, size_t n);
     void *(*memmove_)(void *dest, const void *src, size_t n);
     void *(*realloc_)(void *ptr, size_t n_bytes, bool allow_move);
@@ -13,3 +13,63 @@ QUIZ_CASE(python_template) {
   assert_script_execution_succeeds(Code::ScriptTemplate::Polynomial()->content());
   assert_script_execution_succeeds(Code::ScriptTemplate::Parabola()->content());
 }
+
+QUIZ_CASE(python_native_emitters) {
+  assert_script_execution_succeeds(
+    "import micropython\n"
+    "@micropython.native\n"
+    "def native_sum(n):\n"
+    "  s = 0\n"
+    "  for i in range(n):\n"
+    "    s += i\n"
+    "  return s\n"
+    "@micropython.viper\n"
+    "def viper_sum(n:int) -> int:\n"
+    "  s = 0\n"
+    "  for i in range(n):\n"
+    "    s += i\n"
+    "  return s\n"
+    "@micropython.native\n"
+    "def native_count(n):\n"
+    "  i = 0\n"
+    "  while True:\n"
+    "    i += 1\n"
+    "    if i % 2:\n"
+    "      continue\n"
+    "    try:\n"
+    "      if i >= n:\n"
+    "        break\n"
+    "    finally:\n"
+    "      pass\n"
+    "  return i\n"
+    "@micropython.viper\n"
+    "def viper_count(n:int) -> int:\n"
+    "  i = 0\n"
+    "  while i < n:\n"
+    "    i += 1\n"
+    "  return i\n"
+    "assert native_sum(100) == 4950\n"
+    "assert viper_sum(100) == 4950\n"
+    "assert native_count(100) == 100\n"
+    "assert viper_count(100) == 100\n"
+  );
+}
+
+QUIZ_CASE(python_gc) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import gc");
+  assert_command_execution_succeeds(env, "gc.stats()['collections']", "0\n");
+  assert_command_execution_succeeds(env, "l = [0] * 1000");
+  assert_command_execution_succeeds(env, "del l");
+  assert_command_execution_succeeds(env, "gc.collect()");
+  assert_command_execution_succeeds(env, "s = gc.stats()");
+  assert_command_execution_succeeds(env, "s['collections']", "1\n");
+  assert_command_execution_succeeds(env, "s['peak'] >= 1000 * 4", "True\n");
+  assert_command_execution_succeeds(env, "gc.mem_peak() >= gc.mem_alloc()", "True\n");
+  assert_command_execution_succeeds(env, "s['largest_free'] <= gc.mem_free()", "True\n");
+  assert_command_execution_succeeds(env, "0 <= s['fragmentation'] <= 100", "True\n");
+  assert_command_execution_succeeds(env, "gc.disable()");
+  assert_command_execution_succeeds(env, "gc.isenabled()", "False\n");
+  assert_command_execution_succeeds(env, "gc.enable()");
+  deinit_environment();
+}
@@ -102,6 +102,21 @@ QUIZ_CASE(python_matplotlib_pyplot_plot) {
   deinit_environment();
 }
 
+QUIZ_CASE(python_matplotlib_pyplot_numpy) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "x = np.linspace(0, 3, 30, dtype=np.float32)");
+  assert_command_execution_succeeds(env, "plot(x, np.sin(x))");
+  assert_command_execution_succeeds(env, "plot(x * x)");
+  assert_command_execution_succeeds(env, "scatter(x, 2 - x)");
+  assert_command_execution_succeeds(env, "bar(x, x, 0.1)");
+  assert_command_execution_succeeds(env, "hist(x, np.arange(0, 4))");
+  assert_command_execution_succeeds(env, "show()");
+  assert_command_execution_fails(env, "plot(x, np.zeros(3))");
+  deinit_environment();
+}
+
 QUIZ_CASE(python_matplotlib_pyplot_scatter) {
   TestExecutionEnvironment env = init_environement();
   assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
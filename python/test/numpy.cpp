@@ -0,0 +1,84 @@
+#include <quiz.h>
+#include "execution_environment.h"
+
+QUIZ_CASE(python_numpy_creation) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_fails(env, "zeros(3)");
+  assert_command_execution_succeeds(env, "from numpy import *");
+  assert_command_execution_succeeds(env, "array([1, 2.5, -3])", "array([1.0, 2.5, -3.0])\n");
+  assert_command_execution_succeeds(env, "array((0.1, 2), dtype=float32)", "array([0.1, 2.0], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "array(range(3), dtype='float32').dtype", "'float32'\n");
+  assert_command_execution_succeeds(env, "zeros(2)", "array([0.0, 0.0])\n");
+  assert_command_execution_succeeds(env, "ones(2, dtype=float32)", "array([1.0, 1.0], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "arange(3)", "array([0.0, 1.0, 2.0])\n");
+  assert_command_execution_succeeds(env, "arange(1, 2, 0.25)", "array([1.0, 1.25, 1.5, 1.75])\n");
+  assert_command_execution_succeeds(env, "linspace(0, 1, 5)", "array([0.0, 0.25, 0.5, 0.75, 1.0])\n");
+  assert_command_execution_succeeds(env, "linspace(0, 1, num=4, endpoint=False)", "array([0.0, 0.25, 0.5, 0.75])\n");
+  assert_command_execution_succeeds(env, "len(linspace(0, 1))", "50\n");
+  assert_command_execution_fails(env, "zeros(-1)");
+  assert_command_execution_fails(env, "zeros(2**62)");
+  assert_command_execution_succeeds(env, "class Iterable:\n  def __init__(self, length, count):\n    self.length = length\n    self.count = count\n  def __len__(self):\n    return self.length\n  def __iter__(self):\n    return iter(range(self.count))\n");
+  assert_command_execution_succeeds(env, "array(Iterable(3, 2))", "array([0.0, 1.0])\n");
+  assert_command_execution_succeeds(env, "array(Iterable(2, 3))", "array([0.0, 1.0])\n");
+  assert_command_execution_fails(env, "zeros(2, dtype='int8')");
+  assert_command_execution_fails(env, "arange(0, 1, 0)");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numpy_indexing) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from numpy import *");
+  assert_command_execution_succeeds(env, "a = arange(6)");
+  assert_command_execution_succeeds(env, "a[1]", "1.0\n");
+  assert_command_execution_succeeds(env, "a[-1]", "5.0\n");
+  assert_command_execution_succeeds(env, "a[1:4]", "array([1.0, 2.0, 3.0])\n");
+  assert_command_execution_succeeds(env, "a[::-2]", "array([5.0, 3.0, 1.0])\n");
+  assert_command_execution_succeeds(env, "a[0] = 7");
+  assert_command_execution_succeeds(env, "a[4:] = -1");
+  assert_command_execution_succeeds(env, "a[1:] = a[:-1]");
+  assert_command_execution_succeeds(env, "a", "array([7.0, 7.0, 1.0, 2.0, 3.0, -1.0])\n");
+  assert_command_execution_succeeds(env, "[x for x in a[:2]]", "[7.0, 7.0]\n");
+  assert_command_execution_succeeds(env, "a[2:4].tolist()", "[1.0, 2.0]\n");
+  assert_command_execution_fails(env, "a[6]");
+  assert_command_execution_fails(env, "a[0:2] = zeros(3)");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numpy_arithmetic) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from numpy import *");
+  assert_command_execution_succeeds(env, "a = array([1, 2, 4])");
+  assert_command_execution_succeeds(env, "a + a", "array([2.0, 4.0, 8.0])\n");
+  assert_command_execution_succeeds(env, "a * 2 - 1", "array([1.0, 3.0, 7.0])\n");
+  assert_command_execution_succeeds(env, "1 - a", "array([0.0, -1.0, -3.0])\n");
+  assert_command_execution_succeeds(env, "8.0 / a", "array([8.0, 4.0, 2.0])\n");
+  assert_command_execution_succeeds(env, "a ** 2", "array([1.0, 4.0, 16.0])\n");
+  assert_command_execution_succeeds(env, "-a", "array([-1.0, -2.0, -4.0])\n");
+  assert_command_execution_succeeds(env, "(a + ones(3, dtype=float32)).dtype", "'float64'\n");
+  assert_command_execution_succeeds(env, "b = a");
+  assert_command_execution_succeeds(env, "b += 1");
+  assert_command_execution_succeeds(env, "a", "array([2.0, 3.0, 5.0])\n");
+  assert_command_execution_succeeds(env, "sqrt(array([4, 9]))", "array([2.0, 3.0])\n");
+  assert_command_execution_succeeds(env, "exp(log(array([2.0])))", "array([2.0])\n");
+  assert_command_execution_succeeds(env, "cos(0)", "1.0\n");
+  assert_command_execution_fails(env, "a + zeros(2)");
+  assert_command_execution_fails(env, "a + [1, 2, 3]");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numpy_reductions) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "a = np.array([3, -1, 4, 1.5])");
+  assert_command_execution_succeeds(env, "np.sum(a)", "7.5\n");
+  assert_command_execution_succeeds(env, "a.sum()", "7.5\n");
+  assert_command_execution_succeeds(env, "sum(a)", "7.5\n");
+  assert_command_execution_succeeds(env, "np.min(a)", "-1.0\n");
+  assert_command_execution_succeeds(env, "a.max()", "4.0\n");
+  assert_command_execution_succeeds(env, "np.max([1, 5, 2])", "5.0\n");
+  assert_command_execution_succeeds(env, "np.dot(a, np.ones(4))", "7.5\n");
+  assert_command_execution_succeeds(env, "a.dot([1, 0, 0, 0])", "3.0\n");
+  assert_command_execution_fails(env, "np.min(np.zeros(0))");
+  assert_command_execution_fails(env, "np.dot(a, np.ones(3))");
+  deinit_environment();
+}
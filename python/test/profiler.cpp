@@ -0,0 +1,43 @@
+#include <quiz.h>
+#include <string.h>
+#include "execution_environment.h"
+#include <python/port/profiler.h>
+
+QUIZ_CASE(python_profiler) {
+  MicroPython::Profiler::start();
+  quiz_assert(MicroPython::Profiler::isRunning());
+  assert_script_execution_succeeds(
+      "def f(n):\n"
+      "  s = 0\n"
+      "  for i in range(n):\n"
+      "    s += i * i\n"
+      "  return s\n"
+      "f(20000)\n");
+  MicroPython::Profiler::stop();
+  quiz_assert(!MicroPython::Profiler::isRunning());
+
+  int numberOfHotSpots = MicroPython::Profiler::numberOfHotSpots();
+  quiz_assert(numberOfHotSpots <= MicroPython::Profiler::k_maxNumberOfHotSpots);
+  uint32_t chargedMilliseconds = 0;
+  for (int i = 0; i < numberOfHotSpots; i++) {
+    const MicroPython::Profiler::HotSpot * hotSpot = MicroPython::Profiler::hotSpotAtIndex(i);
+    quiz_assert(i == 0 || hotSpot->milliseconds <= MicroPython::Profiler::hotSpotAtIndex(i-1)->milliseconds);
+    quiz_assert(hotSpot->line >= 1 && hotSpot->line <= 6);
+    chargedMilliseconds += hotSpot->milliseconds;
+  }
+  quiz_assert(chargedMilliseconds <= MicroPython::Profiler::totalMilliseconds());
+
+  constexpr size_t bufferSize = 32;
+  char buffer[bufferSize];
+  MicroPython::Profiler::serializeSummary(buffer, bufferSize);
+  quiz_assert(strncmp(buffer, "Profile: ", 9) == 0);
+  if (numberOfHotSpots > 0) {
+    // The output is truncated to the buffer
+    quiz_assert(MicroPython::Profiler::serializeHotSpot(0, buffer, 4) == 3);
+    quiz_assert(strlen(buffer) == 3);
+  }
+
+  // Scripts run without the profiler do not touch the report
+  assert_script_execution_succeeds("f = 1\n");
+  quiz_assert(MicroPython::Profiler::numberOfHotSpots() == numberOfHotSpots);
+}
@@ -4,22 +4,302 @@
 #include <poincare/init.h>
 #include <poincare/tree_pool.h>
 #include <poincare/exception_checkpoint.h>
+#include <string.h>
+#include <stdlib.h>
+
+/* On the host, cases can be spread among several forked worker processes and
+ * the results can be written to a JSON report. Neither makes sense on the
+ * device, which has no file system nor processes. */
+#if !defined(PLATFORM_DEVICE) && !defined(__WIN32__) && !defined(__EMSCRIPTEN__)
+#define QUIZ_HOST_RUNNER 1
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include <sys/wait.h>
+#else
+#define QUIZ_HOST_RUNNER 0
+#endif
 
 void quiz_print(const char * message) {
   Ion::Console::writeLine(message);
 }
 
-static inline void ion_main_inner() {
-  int i = 0;
-  while (quiz_cases[i] != NULL) {
-    QuizCase c = quiz_cases[i];
-    quiz_print(quiz_case_names[i]);
-    int initialPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
-    quiz_assert(initialPoolSize == 0);
-    c();
-    int currentPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
-    quiz_assert(initialPoolSize == currentPoolSize);
-    i++;
+struct CaseResult {
+  enum class Status : uint8_t {
+    NotRun,
+    Passed,
+    Failed
+  };
+  uint32_t timeMs;
+  uint32_t poolPeakSize;
+  Status status;
+};
+
+class RunnerOptions {
+public:
+  RunnerOptions() : m_filter(nullptr), m_reportPath(nullptr), m_numberOfJobs(1) {}
+  void parse(int argc, const char * const argv[]);
+  bool shouldRun(const char * caseName) const { return m_filter == nullptr || PatternMatches(m_filter, caseName); }
+  const char * reportPath() const { return m_reportPath; }
+  int numberOfJobs() const { return m_numberOfJobs; }
+private:
+  /* Patterns are matched against the whole case name, '*' standing for any
+   * sequence of characters and '?' for any single character. */
+  static bool PatternMatches(const char * pattern, const char * name);
+  const char * m_filter;
+  const char * m_reportPath;
+  int m_numberOfJobs;
+};
+
+void RunnerOptions::parse(int argc, const char * const argv[]) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--filter") == 0 && argc > i+1) {
+      m_filter = argv[++i];
+    } else if (strcmp(argv[i], "--report") == 0 && argc > i+1) {
+      m_reportPath = argv[++i];
+    } else if (strcmp(argv[i], "--jobs") == 0 && argc > i+1) {
+      m_numberOfJobs = atoi(argv[++i]);
+      if (m_numberOfJobs < 1) {
+        m_numberOfJobs = 1;
+      }
+    }
+  }
+#if !QUIZ_HOST_RUNNER
+  m_reportPath = nullptr;
+  m_numberOfJobs = 1;
+#endif
+}
+
+bool RunnerOptions::PatternMatches(const char * pattern, const char * name) {
+  if (*pattern == 0) {
+    return *name == 0;
+  }
+  if (*pattern == '*') {
+    do {
+      if (PatternMatches(pattern + 1, name)) {
+        return true;
+      }
+    } while (*name++ != 0);
+    return false;
+  }
+  if (*name == 0 || (*pattern != '?' && *pattern != *name)) {
+    return false;
+  }
+  return PatternMatches(pattern + 1, name + 1);
+}
+
+static int numberOfCases() {
+  int n = 0;
+  while (quiz_cases[n] != NULL) {
+    n++;
+  }
+  return n;
+}
+
+static void runCase(int i, CaseResult * result) {
+  Poincare::TreePool * pool = Poincare::TreePool::sharedPool();
+  int initialPoolSize = pool->numberOfNodes();
+  quiz_assert(initialPoolSize == 0);
+  pool->resetPeakSize();
+  uint64_t startTime = Ion::Timing::millis();
+  quiz_cases[i]();
+  result->timeMs = Ion::Timing::millis() - startTime;
+  result->poolPeakSize = pool->peakSize();
+  int currentPoolSize = pool->numberOfNodes();
+  quiz_assert(initialPoolSize == currentPoolSize);
+  result->status = CaseResult::Status::Passed;
+}
+
+#if QUIZ_HOST_RUNNER
+
+/* Workers report to the parent through a pipe. A message is sent before a
+ * case starts and after it ends, so that the parent knows which case was
+ * running when a worker died on a failed assertion. */
+struct WorkerMessage {
+  int32_t caseIndex;
+  CaseResult result;
+};
+
+static bool writeMessage(int fd, int caseIndex, const CaseResult & result) {
+  WorkerMessage message = {caseIndex, result};
+  return write(fd, &message, sizeof(message)) == sizeof(message);
+}
+
+static void runWorker(int fd, const RunnerOptions & options, int job, int firstCase) {
+  int numberOfJobs = options.numberOfJobs();
+  for (int i = firstCase; quiz_cases[i] != NULL; i++) {
+    if (i % numberOfJobs != job || !options.shouldRun(quiz_case_names[i])) {
+      continue;
+    }
+    CaseResult result = {0, 0, CaseResult::Status::NotRun};
+    writeMessage(fd, i, result);
+    runCase(i, &result);
+    writeMessage(fd, i, result);
+  }
+}
+
+static pid_t spawnWorker(const RunnerOptions & options, int job, int firstCase, int * fd) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    return -1;
+  }
+  pid_t pid = fork();
+  if (pid == 0) {
+    close(fds[0]);
+    runWorker(fds[1], options, job, firstCase);
+    close(fds[1]);
+    _exit(0);
+  }
+  close(fds[1]);
+  *fd = fds[0];
+  return pid;
+}
+
+static void runCasesInWorkers(const RunnerOptions & options, CaseResult * results) {
+  /* Jobs are interleaved (case i goes to job i % N) so that the slow cases,
+   * which tend to be grouped by module, are spread among workers. When a
+   * worker dies, a new one resumes its job right after the failed case. */
+  const int numberOfJobs = options.numberOfJobs();
+  pid_t * pids = new pid_t[numberOfJobs];
+  int * fds = new int[numberOfJobs];
+  int * runningCase = new int[numberOfJobs];
+  for (int job = 0; job < numberOfJobs; job++) {
+    runningCase[job] = -1;
+    pids[job] = spawnWorker(options, job, 0, &fds[job]);
+    quiz_assert(pids[job] > 0);
+  }
+  int runningJobs = numberOfJobs;
+  while (runningJobs > 0) {
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    int maxFd = -1;
+    for (int job = 0; job < numberOfJobs; job++) {
+      if (pids[job] > 0) {
+        FD_SET(fds[job], &readSet);
+        maxFd = fds[job] > maxFd ? fds[job] : maxFd;
+      }
+    }
+    if (select(maxFd + 1, &readSet, nullptr, nullptr, nullptr) < 0) {
+      continue;
+    }
+    for (int job = 0; job < numberOfJobs; job++) {
+      if (pids[job] <= 0 || !FD_ISSET(fds[job], &readSet)) {
+        continue;
+      }
+      WorkerMessage message;
+      if (read(fds[job], &message, sizeof(message)) == sizeof(message)) {
+        results[message.caseIndex] = message.result;
+        if (message.result.status == CaseResult::Status::NotRun) {
+          runningCase[job] = message.caseIndex;
+        } else {
+          quiz_print(quiz_case_names[message.caseIndex]);
+          runningCase[job] = -1;
+        }
+        continue;
+      }
+      // The worker is done, either because it finished or because it died
+      close(fds[job]);
+      int status;
+      waitpid(pids[job], &status, 0);
+      pids[job] = 0;
+      runningJobs--;
+      if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        continue;
+      }
+      int failedCase = runningCase[job];
+      // Workers only die on a failed assertion, hence inside a case
+      quiz_assert(failedCase >= 0);
+      runningCase[job] = -1;
+      results[failedCase].status = CaseResult::Status::Failed;
+      quiz_print(quiz_case_names[failedCase]);
+      quiz_print("  FAILED");
+      if (quiz_cases[failedCase + 1] != NULL) {
+        pids[job] = spawnWorker(options, job, failedCase + 1, &fds[job]);
+        quiz_assert(pids[job] > 0);
+        runningJobs++;
+      }
+    }
+  }
+  delete[] runningCase;
+  delete[] fds;
+  delete[] pids;
+}
+
+static const char * statusName(CaseResult::Status status) {
+  switch (status) {
+    case CaseResult::Status::Passed:
+      return "passed";
+    case CaseResult::Status::Failed:
+      return "failed";
+    default:
+      return "skipped";
+  }
+}
+
+static void writeReport(const char * path, const CaseResult * results, uint64_t totalTimeMs) {
+  FILE * f = fopen(path, "w");
+  if (f == nullptr) {
+    quiz_print("Could not open the report file");
+    return;
+  }
+  fprintf(f, "{\n  \"total_time_ms\": %llu,\n  \"cases\": [", static_cast<unsigned long long>(totalTimeMs));
+  bool first = true;
+  for (int i = 0; quiz_cases[i] != NULL; i++) {
+    if (results[i].status == CaseResult::Status::NotRun) {
+      continue;
+    }
+    // Case names are C identifiers, they never need to be escaped
+    fprintf(f, "%s\n    {\"name\": \"%s\", \"status\": \"%s\", \"time_ms\": %u, \"pool_peak_size\": %u}",
+        first ? "" : ",",
+        quiz_case_names[i],
+        statusName(results[i].status),
+        static_cast<unsigned>(results[i].timeMs),
+        static_cast<unsigned>(results[i].poolPeakSize));
+    first = false;
+  }
+  fprintf(f, "\n  ]\n}\n");
+  fclose(f);
+}
+
+#endif
+
+static inline void ion_main_inner(const RunnerOptions & options) {
+  int n = numberOfCases();
+  CaseResult * results = new CaseResult[n];
+  for (int i = 0; i < n; i++) {
+    results[i] = {0, 0, CaseResult::Status::NotRun};
+  }
+  uint64_t startTime = Ion::Timing::millis();
+#if QUIZ_HOST_RUNNER
+  if (options.numberOfJobs() > 1) {
+    runCasesInWorkers(options, results);
+  } else
+#endif
+  {
+    for (int i = 0; i < n; i++) {
+      if (!options.shouldRun(quiz_case_names[i])) {
+        continue;
+      }
+      quiz_print(quiz_case_names[i]);
+      runCase(i, &results[i]);
+    }
+  }
+  uint64_t totalTimeMs = Ion::Timing::millis() - startTime;
+#if QUIZ_HOST_RUNNER
+  if (options.reportPath() != nullptr) {
+    writeReport(options.reportPath(), results, totalTimeMs);
+  }
+#else
+  (void)totalTimeMs;
+#endif
+  bool failed = false;
+  for (int i = 0; i < n; i++) {
+    failed = failed || results[i].status == CaseResult::Status::Failed;
+  }
+  delete[] results;
+  if (failed) {
+    quiz_print("SOME TESTS FAILED");
+    quiz_assert(false);
   }
   quiz_print("ALL TESTS FINISHED");
 #ifdef PLATFORM_DEVICE
@@ -36,9 +316,12 @@ void ion_main(int argc, const char * const argv[]) {
   // Initialize Poincare::TreePool::sharedPool
   Poincare::Init();
 
+  RunnerOptions options;
+  options.parse(argc, argv);
+
   Poincare::ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
-    ion_main_inner();
+    ion_main_inner(options);
   } else {
     // There has been a memory allocation problem
 #if POINCARE_TREE_LOG